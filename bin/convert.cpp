@@ -7,8 +7,13 @@
 #include <algorithm>
 #include <iterator>
 #include <iostream>
+#include <fstream>
 #include <optional>
 #include <utility>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
 #include <ranges>
 
 #if GRIDFORMAT_HAVE_MPI
@@ -16,6 +21,7 @@
 #endif
 
 #include <gridformat/common/string_conversion.hpp>
+#include <gridformat/common/concurrency.hpp>
 #include <gridformat/common/logging.hpp>
 #include <gridformat/common/ranges.hpp>
 
@@ -45,6 +51,15 @@ auto make_lz4_compressor() {
 #endif
 }
 
+auto make_zstd_compressor() {
+#if GRIDFORMAT_HAVE_ZSTD
+    return GridFormat::Compression::zstd;
+#else
+    throw_missing_dependency("zstd compressor", "libzstd");
+    return GridFormat::none;
+#endif
+}
+
 auto make_zlib_compressor() {
 #if GRIDFORMAT_HAVE_ZLIB
     return GridFormat::Compression::zlib;
@@ -124,7 +139,7 @@ struct OptsParser<GridFormat::VTK::XMLOptions> {
     static std::vector<std::string> get_all_opts() {
         return {
             "encoder (ascii/base64/raw)",
-            "compressor (zlib/lz4/lzma/none)",
+            "compressor (zlib/lz4/lzma/zstd/adaptive/none)",
             "data-format (inlined/appended)",
             "coordinate-precision (float32/float64)",
             "header-precision (uint32/uint64)"
@@ -149,6 +164,8 @@ struct OptsParser<GridFormat::VTK::XMLOptions> {
         if (comp_str == "zlib") opts.compressor = make_zlib_compressor();
         else if (comp_str == "lz4") opts.compressor = make_lz4_compressor();
         else if (comp_str == "lzma") opts.compressor = make_lzma_compressor();
+        else if (comp_str == "zstd") opts.compressor = make_zstd_compressor();
+        else if (comp_str == "adaptive") opts.compressor = GridFormat::Compression::adaptive;
         else if (comp_str == "none") opts.compressor = GridFormat::none;
         else _throw_option_value_error("compressor", comp_str);
     }
@@ -209,6 +226,168 @@ struct FormatSelector {
     }
 };
 
+// match a filename against a pattern with the wildcards '*' and '?'
+bool matches_pattern(std::string_view name, std::string_view pattern) {
+    std::size_t n = 0, p = 0;
+    std::optional<std::size_t> star_p, star_n;
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) { ++n; ++p; }
+        else if (p < pattern.size() && pattern[p] == '*') { star_p = p++; star_n = n; }
+        else if (star_p) { p = *star_p + 1; n = ++(*star_n); }
+        else return false;
+    }
+    while (p < pattern.size() && pattern[p] == '*') ++p;
+    return p == pattern.size();
+}
+
+bool is_glob_pattern(const std::string& filename) {
+    return filename.find_first_of("*?") != std::string::npos;
+}
+
+std::vector<std::string> expand_glob_pattern(const std::string& pattern) {
+    const std::filesystem::path pattern_path{pattern};
+    const auto folder = pattern_path.has_parent_path() ? pattern_path.parent_path() : std::filesystem::path{"."};
+    if (is_glob_pattern(folder.string()))
+        throw std::runtime_error("Wildcards are only supported in the filename, not in the directory");
+
+    std::vector<std::string> result;
+    for (const auto& entry : std::filesystem::directory_iterator{folder})
+        if (entry.is_regular_file() && matches_pattern(entry.path().filename().string(), pattern_path.filename().string()))
+            result.push_back((pattern_path.has_parent_path() ? entry.path() : entry.path().filename()).string());
+    std::ranges::sort(result);
+    return result;
+}
+
+std::vector<std::string> read_file_list(const std::string& list_filename) {
+    std::ifstream list_file{list_filename};
+    if (!list_file)
+        throw std::runtime_error("Could not open file list '" + list_filename + "'");
+    std::vector<std::string> result;
+    for (std::string line; std::getline(list_file, line); )
+        if (line.erase(line.find_last_not_of(" \t\r") + 1); !line.empty())
+            result.push_back(line);
+    return result;
+}
+
+std::vector<std::string> read_pvd_data_sets(const std::string& pvd_filename) {
+    const auto helper = GridFormat::VTK::XMLReaderHelper::make_from(pvd_filename, "Collection");
+    std::vector<std::string> result;
+    for (const auto& data_set : children(helper.get("Collection")) | std::views::filter([] (const auto& e) {
+        return e.name() == "DataSet";
+    })) {
+        const std::filesystem::path file{data_set.get_attribute("file")};
+        result.push_back((file.is_absolute() ? file : std::filesystem::path{pvd_filename}.parent_path() / file).string());
+    }
+    return result;
+}
+
+// Return the files to be converted in batch mode, given as a glob pattern, a list file (@FILE) or a .pvd file
+std::vector<std::string> batch_inputs(const std::string& in_filename) {
+    if (in_filename.starts_with("@")) return read_file_list(in_filename.substr(1));
+    if (is_glob_pattern(in_filename)) return expand_glob_pattern(in_filename);
+    if (in_filename.ends_with(".pvd")) return read_pvd_data_sets(in_filename);
+    throw std::runtime_error(
+        "Batch mode expects a glob pattern, a file list (@FILE) or a .pvd file, got '" + in_filename + "'"
+    );
+}
+
+// Prints the status messages of a batch of conversions in the order of the inputs
+class OrderedProgress {
+ public:
+    OrderedProgress(std::size_t number_of_files, bool quiet)
+    : _messages(number_of_files)
+    , _quiet{quiet}
+    {}
+
+    void report(std::size_t i, std::string message, bool is_error = false) {
+        std::scoped_lock lock{_mutex};
+        _messages[i] = std::make_pair(std::move(message), is_error);
+        for (; _next < _messages.size() && _messages[_next].has_value(); ++_next) {
+            const auto& [msg, error] = _messages[_next].value();
+            if (error)
+                std::cout << GridFormat::as_error(msg) << std::endl;
+            else if (!_quiet)
+                std::cout << msg << std::endl;
+        }
+    }
+
+ private:
+    std::mutex _mutex;
+    std::vector<std::optional<std::pair<std::string, bool>>> _messages;
+    std::size_t _next = 0;
+    bool _quiet;
+};
+
+// Return true if converting the given file involves reading a (vtk-)hdf file
+bool reads_hdf(const std::string& in_filename, const std::string& in_fmt) {
+    if (in_fmt == "vtk-hdf")
+        return true;
+    if (in_filename.ends_with(".pvd"))
+        return std::ranges::any_of(read_pvd_data_sets(in_filename), [&] (const std::string& data_set) {
+            return reads_hdf(data_set, in_fmt);
+        });
+    return GridFormat::APIDetail::has_hdf_file_extension(in_filename)
+        || GridFormat::APIDetail::has_hdf_signature(in_filename);
+}
+
+// Return the output filenames (without extension) for the given files in batch mode
+std::vector<std::filesystem::path> batch_outputs(const std::vector<std::string>& in_filenames,
+                                                 const std::optional<std::filesystem::path>& out_folder) {
+    std::vector<std::filesystem::path> result;
+    std::unordered_map<std::string, std::string> inputs_per_output;
+    for (const auto& in_filename : in_filenames) {
+        const std::filesystem::path in_path{in_filename};
+        auto out_path = out_folder.value_or(in_path.parent_path()) / (in_path.stem().string() + "_converted");
+        const auto [it, inserted] = inputs_per_output.emplace(
+            std::filesystem::absolute(out_path).lexically_normal().string(),
+            in_filename
+        );
+        if (!inserted)
+            throw std::runtime_error(
+                "Files '" + it->second + "' and '" + in_filename + "' would be converted into the same "
+                + "output file '" + out_path.string() + "'"
+            );
+        result.push_back(std::move(out_path));
+    }
+    return result;
+}
+
+// Convert the given files with a pool of worker threads, each one converting one file at a time.
+// Conversions for which `is_serial` returns true are not run concurrently with each other, since
+// HDF5 libraries are not necessarily built thread-safe. Returns the number of failed conversions.
+template<typename ConvertFunction, typename SerialPredicate>
+std::size_t convert_batch(const std::vector<std::string>& in_filenames,
+                          const std::vector<std::filesystem::path>& out_paths,
+                          std::size_t number_of_jobs,
+                          bool quiet,
+                          const ConvertFunction& convert_one,
+                          const SerialPredicate& is_serial) {
+
+    std::mutex serial_mutex;
+    std::atomic<std::size_t> next_file = 0;
+    std::atomic<std::size_t> number_of_failures = 0;
+    OrderedProgress progress{in_filenames.size(), quiet};
+    const auto progress_prefix = [&] (std::size_t i) {
+        return "[" + std::to_string(i + 1) + "/" + std::to_string(in_filenames.size()) + "] ";
+    };
+    GridFormat::run_concurrently(std::min(number_of_jobs, in_filenames.size()), [&] (std::size_t) {
+        for (std::size_t i = next_file++; i < in_filenames.size(); i = next_file++) {
+            const std::filesystem::path in_path{in_filenames[i]};
+            try {
+                std::unique_lock lock{serial_mutex, std::defer_lock};
+                if (is_serial(in_path.string()))
+                    lock.lock();
+                const std::string written = convert_one(in_path.string(), out_paths[i].string());
+                progress.report(i, progress_prefix(i) + "Converted '" + in_path.string() + "' into '" + written + "'");
+            } catch (const std::exception& e) {
+                number_of_failures++;
+                progress.report(i, progress_prefix(i) + "Could not convert '" + in_path.string() + "': " + e.what(), true);
+            }
+        }
+    });
+    return number_of_failures;
+}
+
 template<GridFormat::Concepts::Communicator Communicator>
 void convert_file(std::string in_filename,
                   const std::string& out_fmt,
@@ -235,10 +414,6 @@ void convert_file(std::string in_filename,
         rank_specific_files = true;
     }
 
-    std::filesystem::path in_path{in_filename};
-    if (!std::filesystem::exists(in_path))
-        throw std::runtime_error("Given file '" + in_filename + "' does not exist.");
-
     const auto parse_arg = [&] (const std::string& short_key, const std::string& long_key) -> std::optional<std::string> {
         const auto process = [&] (const std::string& key) -> std::optional<std::string> {
             if (auto it = std::ranges::find(opts, key); it != opts.end()) {
@@ -264,15 +439,36 @@ void convert_file(std::string in_filename,
         return {};
     };
 
-    std::string out_filename = (in_path.parent_path() / in_path.stem()).string() + "_converted";
-    if (auto f = parse_single_arg("-o", "--out-filename"); f) out_filename = f.value();
+    const auto parse_flag = [&] (const std::string& short_key, const std::string& long_key) {
+        bool result = false;
+        if (auto it = std::ranges::find(opts, short_key); it != opts.end()) { opts.erase(it); result = true; }
+        if (auto it = std::ranges::find(opts, long_key); it != opts.end()) { opts.erase(it); result = true; }
+        return result;
+    };
+
+    const auto out_filename_arg = parse_single_arg("-o", "--out-filename");
 
     std::string in_fmt = "any";
     if (auto f = parse_single_arg("-i", "--input-format"); f) in_fmt = f.value();
 
-    bool quiet = false;
-    if (auto it = std::ranges::find(opts, "-q"); it != opts.end()) { opts.erase(it); quiet = true; }
-    if (auto it = std::ranges::find(opts, "--quiet"); it != opts.end()) { opts.erase(it); quiet = true; }
+    std::size_t number_of_jobs = GridFormat::hardware_concurrency();
+    if (auto j = parse_single_arg("-j", "--jobs"); j) {
+        number_of_jobs = GridFormat::from_string<std::size_t>(j.value());
+        if (number_of_jobs == 0)
+            throw std::runtime_error("Number of jobs must be positive");
+    }
+
+    const bool quiet = parse_flag("-q", "--quiet");
+    const bool batch = parse_flag("-b", "--batch") || in_filename.starts_with("@") || is_glob_pattern(in_filename);
+    if (batch && rank_specific_files)
+        throw std::runtime_error("Rank placeholders cannot be used in batch mode");
+
+    std::filesystem::path in_path{in_filename};
+    if (!batch && !std::filesystem::exists(in_path))
+        throw std::runtime_error("Given file '" + in_filename + "' does not exist.");
+    const std::string out_filename = out_filename_arg.value_or(
+        (in_path.parent_path() / in_path.stem()).string() + "_converted"
+    );
 
     bool is_rank_0 = GridFormat::Parallel::rank(c) == 0;
     auto options_map = make_options_map(opts | std::views::all);
@@ -282,6 +478,39 @@ void convert_file(std::string in_filename,
             if constexpr (ExposesOptions<Format>)
                 fmt.opts = fmt_opts;
 
+            if (batch) {
+                // distribute the files over the ranks, each of which converts its files sequentially
+                std::optional<std::filesystem::path> out_folder;
+                if (out_filename_arg) out_folder = out_filename_arg.value();
+                const auto all_files = batch_inputs(in_filename);
+                const auto all_out_paths = batch_outputs(all_files, out_folder);
+                if (out_folder)
+                    std::filesystem::create_directories(out_folder.value());
+
+                std::vector<std::string> files;
+                std::vector<std::filesystem::path> out_paths;
+                for (std::size_t i = GridFormat::Parallel::rank(c); i < all_files.size(); i += GridFormat::Parallel::size(c)) {
+                    files.push_back(all_files[i]);
+                    out_paths.push_back(all_out_paths[i]);
+                }
+                const GridFormat::ConversionOptions<Format, InFormat> batch_opts{.out_format = fmt, .verbosity = 0};
+                const auto failures = convert_batch(
+                    files,
+                    out_paths,
+                    number_of_jobs,
+                    quiet,
+                    [&] (const std::string& in, const std::string& out) {
+                        return GridFormat::convert(in, out, batch_opts);
+                    },
+                    [&] (const std::string& in) {
+                        return out_fmt == "vtk-hdf" || reads_hdf(in, in_fmt);
+                    }
+                );
+                if (failures > 0)
+                    throw std::runtime_error("Conversion of " + std::to_string(failures) + " file(s) failed");
+                return;
+            }
+
             const GridFormat::ConversionOptions<Format, InFormat> conversion_opts{
                 .out_format = fmt,
                 .verbosity = (
@@ -318,14 +547,16 @@ void print_help() {
     };
 
     std::cout << "usage: [mpirun -n NUM_RANKS] gridformat-convert FILE TARGET_FORMAT [TARGET_FORMAT_OPTIONS] "
-              << "[-o | --out-filename OUT_FILENAME] [-q --quiet] [-i --input-format]" << std::endl;
+              << "[-o | --out-filename OUT_FILENAME] [-q --quiet] [-i --input-format] [-b | --batch] [-j | --jobs N]" << std::endl;
     std::cout << std::endl;
     print_arg_line(
         "FILE",
         "The file to be converted. May contain '{RANK}', a placeholder that is substituted\n"
         "by the process rank and which allows you to read different files per process (e.g. to\n"
         "merge them into one parallel file). Use '{RANK:N}' in order to specify a fixed width\n"
-        "that is filled with leading zeros. For instance: '{RANK:3}' will yield 001 on rank 0."
+        "that is filled with leading zeros. For instance: '{RANK:3}' will yield 001 on rank 0.\n"
+        "In batch mode, FILE can be a (quoted) pattern with the wildcards '*' and '?' in the\n"
+        "filename, '@LIST' with LIST being a file with one input filename per line, or a .pvd file."
     );
     print_arg_line(
         "TARGET_FORMAT",
@@ -345,6 +576,20 @@ void print_help() {
         "the given file without the extension."
     );
     print_arg_line("-q | --quiet", "Use this flag to suppress progress output.");
+    print_arg_line(
+        "-b | --batch",
+        "Convert each of the files given by FILE separately (see above). Batch mode is\n"
+        "used automatically if FILE contains wildcards or starts with '@'. Outputs are named\n"
+        "'${FILE*}_converted.NEW_EXTENSION', and '-o' specifies the folder to write them into.\n"
+        "Files that would be converted into the same output file are rejected. With MPI, the\n"
+        "files are distributed over the processes."
+    );
+    print_arg_line(
+        "-j | --jobs",
+        "The number of files converted concurrently in batch mode (per process).\n"
+        "Defaults to the number of hardware threads. Conversions from or into vtk-hdf\n"
+        "are carried out one at a time."
+    );
     print_arg_line(
         "-i | --input-format",
         "Specify the format of FILE. If unspecified, it is deduced from its extension.\n"
@@ -8,6 +8,9 @@ function (gridformat_register_feature DESCRIPTION VARIABLE DOCSTRING)
     endif ()
 endfunction ()
 
+find_package(Threads REQUIRED)
+target_link_libraries(${PROJECT_NAME} INTERFACE Threads::Threads)
+
 find_package(ZLIB)
 if (ZLIB_FOUND)
     target_link_libraries(${PROJECT_NAME} INTERFACE ZLIB::ZLIB)
@@ -32,6 +35,14 @@ if (LZMA_FOUND)
 endif ()
 gridformat_register_feature("LZMA compression" GRIDFORMAT_HAVE_LZMA "writing and reading arrays compressed with LZMA")
 
+find_package(ZSTD 1.4)  # for the advanced compression api
+if (ZSTD_FOUND)
+    target_link_libraries(${PROJECT_NAME} INTERFACE ZSTD::ZSTD)
+    target_compile_definitions(${PROJECT_NAME} INTERFACE GRIDFORMAT_HAVE_ZSTD)
+    set(GRIDFORMAT_HAVE_ZSTD true)
+endif ()
+gridformat_register_feature("ZSTD compression" GRIDFORMAT_HAVE_ZSTD "writing and reading arrays compressed with Zstandard")
+
 find_package(MPI COMPONENTS CXX)
 if (MPI_FOUND)
     target_link_libraries(${PROJECT_NAME} INTERFACE MPI::MPI_CXX)
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Helpers for running tasks on multiple threads.
+ */
+#ifndef GRIDFORMAT_COMMON_CONCURRENCY_HPP_
+#define GRIDFORMAT_COMMON_CONCURRENCY_HPP_
+
+#include <vector>
+#include <thread>
+#include <cstddef>
+#include <algorithm>
+#include <exception>
+
+namespace GridFormat {
+
+//! \addtogroup Common
+//! \{
+
+//! Return the number of threads supported by the hardware (at least 1)
+inline std::size_t hardware_concurrency() {
+    return std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t{1});
+}
+
+/*!
+ * \brief Invoke the given action for all task indices in `[0, number_of_tasks)`,
+ *        each one on a separate thread. The first task runs on the calling thread.
+ * \note Exceptions thrown by the tasks are propagated to the caller after all threads
+ *       have been joined. If multiple tasks throw, the exception of the task with the
+ *       lowest index is rethrown.
+ */
+template<typename Action>
+void run_concurrently(std::size_t number_of_tasks, const Action& action) {
+    if (number_of_tasks == 0)
+        return;
+    if (number_of_tasks == 1)
+        return action(std::size_t{0});
+
+    std::vector<std::exception_ptr> errors(number_of_tasks);
+    const auto run_task = [&] (std::size_t i) {
+        try { action(i); }
+        catch (...) { errors[i] = std::current_exception(); }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(number_of_tasks - 1);
+    for (std::size_t i = 1; i < number_of_tasks; ++i)
+        threads.emplace_back(run_task, i);
+    run_task(0);
+    std::ranges::for_each(threads, [] (std::thread& t) { t.join(); });
+
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+//! \} group Common
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_CONCURRENCY_HPP_
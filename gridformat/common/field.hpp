@@ -70,6 +70,15 @@ class Field {
         return result;
     }
 
+    /*!
+     * \brief Hint that the field values will be requested soon.
+     * \details Fields that read their values lazily (e.g. from a file) may load them upon this call,
+     *          such that this can be done ahead of time, for instance, on another thread.
+     */
+    void prefetch() const {
+        _prefetch();
+    }
+
     //! Visit the scalar values of the field in the form of an std::span
     template<typename Visitor>
     decltype(auto) visit_field_values(Visitor&& visitor) const {
@@ -125,6 +134,7 @@ class Field {
     virtual MDLayout _layout() const = 0;
     virtual DynamicPrecision _precision() const = 0;
     virtual Serialization _serialized() const = 0;
+    virtual void _prefetch() const {}
 
     //! Export the field values into the provided range and return it
     template<bool enable_resize, std::ranges::range R> requires(Concepts::Scalar<MDRangeValueType<R>>)
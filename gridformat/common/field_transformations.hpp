@@ -9,6 +9,9 @@
 #define GRIDFORMAT_COMMON_FIELD_TRANSFORMATIONS_HPP_
 
 #include <vector>
+#include <array>
+#include <span>
+#include <cassert>
 #include <utility>
 #include <concepts>
 #include <algorithm>
@@ -143,6 +146,34 @@ namespace FieldTransformationDetail {
         std::size_t _current_target_flat;
     };
 
+    // Pads the (row-major) sub-blocks of a buffer holding n blocks with
+    // extents (rows, cols) to blocks of extents (target_rows, target_cols).
+    // The data is expected to occupy the front of the (already resized)
+    // buffer, and it is moved backwards in a single pass over the values,
+    // such that each value is only read once, before it is overwritten.
+    template<typename T>
+    void pad_blocks_in_place(std::span<T> data,
+                             const std::size_t n,
+                             const std::array<std::size_t, 2>& extents,
+                             const std::array<std::size_t, 2>& target_extents) {
+        const auto [rows, cols] = extents;
+        const auto [target_rows, target_cols] = target_extents;
+        assert(rows <= target_rows && cols <= target_cols);
+        assert(n*target_rows*target_cols <= data.size());
+
+        T* begin = data.data();
+        for (std::size_t i = n; i-- > 0;) {
+            T* target_block = begin + i*target_rows*target_cols;
+            std::fill(target_block + rows*target_cols, target_block + target_rows*target_cols, T{0});
+            for (std::size_t r = rows; r-- > 0;) {
+                const T* source_row = begin + (i*rows + r)*cols;
+                T* target_row = target_block + r*target_cols;
+                std::copy_backward(source_row, source_row + cols, target_row + cols);
+                std::fill(target_row + cols, target_row + target_cols, T{0});
+            }
+        }
+    }
+
 }  // namespace FieldTransformationDetail
 #endif  // DOXYGEN
 
@@ -288,6 +319,29 @@ class ExtendedField : public Field {
         if (orig_layout == new_layout)
             return serialization;
 
+        // fast path for vectors & matrices (e.g. N×2 -> N×3 or N×2×2 -> N×3×3)
+        if (orig_layout.dimension() <= 3) {
+            const bool is_vector = orig_layout.dimension() == 2;
+            const std::array<std::size_t, 2> extents{
+                is_vector ? 1 : orig_layout.extent(1),
+                orig_layout.extent(orig_layout.dimension() - 1)
+            };
+            const std::array<std::size_t, 2> target_extents{
+                is_vector ? 1 : new_layout.extent(1),
+                new_layout.extent(new_layout.dimension() - 1)
+            };
+            _field->precision().visit([&] <typename T> (const Precision<T>&) {
+                serialization.resize(new_layout.number_of_entries()*sizeof(T));
+                FieldTransformationDetail::pad_blocks_in_place(
+                    serialization.template as_span_of<T>(),
+                    orig_layout.extent(0),
+                    extents,
+                    target_extents
+                );
+            });
+            return serialization;
+        }
+
         using Walk = FieldTransformationDetail::BackwardsMDIndexMapWalk;
         Walk index_walk{orig_layout, new_layout};
 
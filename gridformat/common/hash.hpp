@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Fast non-cryptographic hashing of binary data.
+ */
+#ifndef GRIDFORMAT_COMMON_HASH_HPP_
+#define GRIDFORMAT_COMMON_HASH_HPP_
+
+#include <bit>
+#include <span>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace GridFormat {
+
+#ifndef DOXYGEN
+namespace HashDetail {
+
+    inline constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    inline constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    inline constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+    inline constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    inline constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    template<typename T>
+    T read_little_endian(const std::byte* data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big) {
+            auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+            for (std::size_t i = 0; i < sizeof(T)/2; ++i)
+                std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+            value = std::bit_cast<T>(bytes);
+        }
+        return value;
+    }
+
+    inline std::uint64_t round(std::uint64_t acc, std::uint64_t input) {
+        return std::rotl(acc + input*prime2, 31)*prime1;
+    }
+
+    inline std::uint64_t merge_round(std::uint64_t acc, std::uint64_t value) {
+        return (acc ^ round(0, value))*prime1 + prime4;
+    }
+
+}  // namespace HashDetail
+#endif  // DOXYGEN
+
+/*!
+ * \ingroup Common
+ * \brief Compute the 64-bit xxHash (XXH64) of the given bytes.
+ * \details This is a fast non-cryptographic hash, suitable for detecting whether (large) data
+ *          has changed. The result is independent of the byte order of the platform.
+ */
+inline std::uint64_t xxhash64(std::span<const std::byte> data, std::uint64_t seed = 0) {
+    using namespace HashDetail;
+    const std::byte* p = data.data();
+    const std::byte* const end = p + data.size();
+
+    std::uint64_t hash;
+    if (data.size() >= 32) {
+        std::array<std::uint64_t, 4> acc{seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+        for (; p + 32 <= end; p += 32)
+            for (std::size_t i = 0; i < 4; ++i)
+                acc[i] = HashDetail::round(acc[i], read_little_endian<std::uint64_t>(p + 8*i));
+        hash = std::rotl(acc[0], 1) + std::rotl(acc[1], 7) + std::rotl(acc[2], 12) + std::rotl(acc[3], 18);
+        for (const auto a : acc)
+            hash = merge_round(hash, a);
+    } else {
+        hash = seed + prime5;
+    }
+
+    hash += static_cast<std::uint64_t>(data.size());
+    for (; p + 8 <= end; p += 8)
+        hash = std::rotl(hash ^ HashDetail::round(0, read_little_endian<std::uint64_t>(p)), 27)*prime1 + prime4;
+    if (p + 4 <= end) {
+        hash = std::rotl(hash ^ (static_cast<std::uint64_t>(read_little_endian<std::uint32_t>(p))*prime1), 23)*prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p)
+        hash = std::rotl(hash ^ (static_cast<std::uint64_t>(std::to_integer<std::uint8_t>(*p))*prime5), 11)*prime1;
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_HASH_HPP_
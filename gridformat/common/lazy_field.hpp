@@ -9,6 +9,7 @@
 #define GRIDFORMAT_COMMON_LAZY_FIELD_HPP_
 
 #include <utility>
+#include <optional>
 #include <concepts>
 #include <type_traits>
 
@@ -22,6 +23,7 @@ namespace GridFormat {
 /*!
  * \ingroup Common
  * \brief Field implementation that reads values lazily from a source upon request.
+ * \note After a call to prefetch(), the values are read once and kept in memory.
  */
 template<typename S>
 class LazyField : public Field {
@@ -53,13 +55,21 @@ class LazyField : public Field {
     }
 
     Serialization _serialized() const override {
+        if (_prefetched)
+            return _prefetched.value();
         return _serialization_callback(_source);
     }
 
+    void _prefetch() const override {
+        if (!_prefetched)
+            _prefetched = _serialization_callback(_source);
+    }
+
     S _source;
     MDLayout _md_layout;
     DynamicPrecision _scalar_precision;
     SerializationCallBack _serialization_callback;
+    mutable std::optional<Serialization> _prefetched;
 };
 
 template<typename S, typename CB>
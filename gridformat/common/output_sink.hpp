@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Sinks that receive the output of writers as in-memory buffers instead of files.
+ */
+#ifndef GRIDFORMAT_COMMON_OUTPUT_SINK_HPP_
+#define GRIDFORMAT_COMMON_OUTPUT_SINK_HPP_
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <concepts>
+#include <functional>
+
+#include <gridformat/common/exceptions.hpp>
+
+namespace GridFormat {
+
+//! \addtogroup Common
+//! \{
+
+//! A complete output (e.g. a file or a piece of a parallel file) together with its name
+struct OutputBuffer {
+    std::string name;
+    std::string content;
+};
+
+/*!
+ * \brief Interface for receivers of writer output.
+ *        Writers deliver each file they would otherwise create as a complete buffer
+ *        together with the name of that file. Parallel writers deliver the piece
+ *        written by each process on that process.
+ */
+class OutputSink {
+ public:
+    virtual ~OutputSink() = default;
+
+    void receive(std::string name, std::string content) {
+        _receive(OutputBuffer{std::move(name), std::move(content)});
+    }
+
+ private:
+    virtual void _receive(OutputBuffer&&) = 0;
+};
+
+//! Sink that forwards all received buffers to a user-defined callback
+class CallbackSink : public OutputSink {
+ public:
+    using Callback = std::function<void(OutputBuffer&&)>;
+
+    template<std::invocable<OutputBuffer&&> C>
+    explicit CallbackSink(C&& callback)
+    : _callback(std::forward<C>(callback))
+    {}
+
+ private:
+    void _receive(OutputBuffer&& buffer) override {
+        _callback(std::move(buffer));
+    }
+
+    Callback _callback;
+};
+
+/*!
+ * \brief Sink that stores received buffers in a bounded first-in-first-out queue.
+ *        If the capacity is exceeded, the oldest buffer is dropped, such that a
+ *        slow consumer always sees the most recent output. Receiving and popping
+ *        buffers is safe to do concurrently from different threads.
+ */
+class RingBufferSink : public OutputSink {
+ public:
+    explicit RingBufferSink(std::size_t capacity)
+    : _capacity{capacity} {
+        if (_capacity == 0)
+            throw ValueError("Ring buffer capacity must be positive");
+    }
+
+    //! Remove and return the oldest buffer (if any)
+    std::optional<OutputBuffer> try_pop() {
+        std::scoped_lock lock{_mutex};
+        if (_buffers.empty())
+            return {};
+        OutputBuffer result = std::move(_buffers.front());
+        _buffers.pop_front();
+        return result;
+    }
+
+    //! Return the number of buffers currently held
+    std::size_t size() const {
+        std::scoped_lock lock{_mutex};
+        return _buffers.size();
+    }
+
+    //! Return the number of buffers that were dropped due to the capacity being exceeded
+    std::size_t number_of_dropped_buffers() const {
+        std::scoped_lock lock{_mutex};
+        return _num_dropped;
+    }
+
+    std::size_t capacity() const {
+        return _capacity;
+    }
+
+ private:
+    void _receive(OutputBuffer&& buffer) override {
+        std::scoped_lock lock{_mutex};
+        if (_buffers.size() == _capacity) {
+            _buffers.pop_front();
+            _num_dropped++;
+        }
+        _buffers.push_back(std::move(buffer));
+    }
+
+    std::size_t _capacity;
+    std::size_t _num_dropped = 0;
+    std::deque<OutputBuffer> _buffers;
+    mutable std::mutex _mutex;
+};
+
+//! \} group Common
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_OUTPUT_SINK_HPP_
@@ -11,5 +11,8 @@
 #include <gridformat/compression/lzma.hpp>
 #include <gridformat/compression/zlib.hpp>
 #include <gridformat/compression/lz4.hpp>
+#include <gridformat/compression/zstd.hpp>
+#include <gridformat/compression/pre_filter.hpp>
+#include <gridformat/compression/adaptive.hpp>
 
 #endif  // GRIDFORMAT_COMPRESSION_HPP_
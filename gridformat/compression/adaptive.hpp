@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Compression
+ * \brief Adaptive selection of a compressor per data array.
+ */
+#ifndef GRIDFORMAT_COMPRESSION_ADAPTIVE_HPP_
+#define GRIDFORMAT_COMPRESSION_ADAPTIVE_HPP_
+
+#include <span>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <variant>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <gridformat/common/type_traits.hpp>
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/serialization.hpp>
+
+#include <gridformat/compression/common.hpp>
+#include <gridformat/compression/lz4.hpp>
+#include <gridformat/compression/lzma.hpp>
+#include <gridformat/compression/zlib.hpp>
+#include <gridformat/compression/zstd.hpp>
+
+namespace GridFormat::Compression {
+
+//! \addtogroup Compression
+//! \{
+
+//! Options for the adaptive compressor selection
+struct AdaptiveOptions {
+    std::size_t block_size = default_block_size;  //!< block size used by all candidates
+    std::size_t number_of_sample_blocks = 1;  //!< number of leading blocks used to evaluate the candidates
+    double write_bandwidth = 500e6;  //!< bytes per second with which the output is assumed to be written
+    std::size_t min_array_size = 1024;  //!< arrays with fewer bytes are not compressed
+};
+
+/*!
+ * \brief Selects the compressor for each data array individually.
+ * \details Each candidate compresses the first block(s) of an array, and the one that minimizes
+ *          the estimated time for compressing and writing the entire array (with the configured
+ *          write bandwidth) is selected. Leaving the array uncompressed is always a candidate.
+ *          Thus, tiny arrays or incompressible data are written uncompressed, and more expensive
+ *          compressors are only chosen if the saved bytes outweigh the additional compression time.
+ * \note Since the selection is based on time measurements, the choice for an array may differ
+ *       between runs.
+ */
+class Adaptive {
+ public:
+    using Options = AdaptiveOptions;
+    using Candidate = UniqueVariant<
+        None,
+        std::conditional_t<Detail::_have_lz4, LZ4, None>,
+        std::conditional_t<Detail::_have_zlib, ZLIB, None>,
+        std::conditional_t<Detail::_have_zstd, ZSTD, None>,
+        std::conditional_t<Detail::_have_lzma, LZMA, None>
+    >;
+
+    //! Construct with all available compressors as candidates
+    explicit Adaptive(Options opts = {})
+    : Adaptive(opts, _default_candidates(opts.block_size))
+    {}
+
+    //! Construct with custom candidates
+    Adaptive(Options opts, std::vector<Candidate> candidates)
+    : _opts{std::move(opts)}
+    , _candidates{std::move(candidates)} {
+        if (_opts.number_of_sample_blocks == 0)
+            throw ValueError("Number of sample blocks must be positive");
+    }
+
+    static Adaptive with(Options opts) {
+        return Adaptive{std::move(opts)};
+    }
+
+    const std::vector<Candidate>& candidates() const {
+        return _candidates;
+    }
+
+    //! Return the compressor that is expected to be fastest for compressing & writing the given data
+    Candidate select(std::span<const std::byte> data) const {
+        Candidate best = None{};
+        if (data.size() < _opts.min_array_size)
+            return best;
+
+        const std::size_t sample_size = std::min(data.size(), _opts.number_of_sample_blocks*_opts.block_size);
+        const double scale = static_cast<double>(data.size())/static_cast<double>(sample_size);
+        // uncompressed arrays are preceded by a single header entry containing their size
+        double best_cost = static_cast<double>(data.size() + sizeof(std::size_t))/_opts.write_bandwidth;
+        for (const auto& candidate : _candidates) {
+            const double cost = std::visit([&] <typename C> (const C& compressor) {
+                if constexpr (is_none<C>)
+                    return std::numeric_limits<double>::max();
+                else
+                    return scale*_sample_cost(compressor, data.first(sample_size));
+            }, candidate);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = candidate;
+            }
+        }
+        return best;
+    }
+
+ private:
+    template<typename C>
+    double _sample_cost(const C& compressor, std::span<const std::byte> sample) const {
+        Serialization bytes{sample.size()};
+        std::ranges::copy(sample, bytes.as_span().begin());
+        const auto start = std::chrono::steady_clock::now();
+        const auto blocks = compressor.compress(bytes);
+        const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        // account for the block sizes written in addition to the compressed data
+        const std::size_t size = blocks.compressed_size() + sizeof(std::size_t)*(blocks.number_of_blocks + 3);
+        return time.count() + static_cast<double>(size)/_opts.write_bandwidth;
+    }
+
+    static std::vector<Candidate> _default_candidates([[maybe_unused]] std::size_t block_size) {
+        std::vector<Candidate> result;
+#if GRIDFORMAT_HAVE_LZ4
+        result.push_back(LZ4{{.block_size = block_size}});
+#endif
+#if GRIDFORMAT_HAVE_ZLIB
+        result.push_back(ZLIB{{.block_size = block_size}});
+#endif
+#if GRIDFORMAT_HAVE_ZSTD
+        result.push_back(ZSTD{{.block_size = block_size}});
+#endif
+#if GRIDFORMAT_HAVE_LZMA
+        result.push_back(LZMA{{.block_size = block_size}});
+#endif
+        return result;
+    }
+
+    Options _opts;
+    std::vector<Candidate> _candidates;
+};
+
+inline const Adaptive adaptive;  //!< Instance of the adaptive compressor selection
+
+//! \} group Compression
+
+}  // namespace GridFormat::Compression
+
+#endif  // GRIDFORMAT_COMPRESSION_ADAPTIVE_HPP_
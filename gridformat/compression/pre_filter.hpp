@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Compression
+ * \brief Reversible filters that rearrange data prior to compression to improve compression ratios.
+ */
+#ifndef GRIDFORMAT_COMPRESSION_PRE_FILTER_HPP_
+#define GRIDFORMAT_COMPRESSION_PRE_FILTER_HPP_
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/serialization.hpp>
+
+namespace GridFormat::Compression {
+
+//! \addtogroup Compression
+//! \{
+
+//! Ways of shuffling the bytes of an array of values
+enum class Shuffle {
+    none,  //!< leave the bytes as they are
+    byte,  //!< group the i-th bytes of all values together
+    bit    //!< group the i-th bits of all values together
+};
+
+/*!
+ * \brief Options for a reversible filter applied to the data before compression.
+ * \details Shuffling groups the bytes (or bits) of equal significance of all values,
+ *          which usually yields long runs of similar bytes for floating-point data.
+ *          Delta encoding stores the difference between consecutive values instead of
+ *          the values themselves, which is beneficial for slowly varying integer arrays
+ *          like connectivity or offsets. Delta encoding is only applied to integral arrays.
+ */
+struct PreFilter {
+    Shuffle shuffle = Shuffle::none;
+    bool delta = false;
+
+    bool operator==(const PreFilter&) const = default;
+
+    //! Return true if this filter does not modify the data
+    bool is_identity() const {
+        return shuffle == Shuffle::none && !delta;
+    }
+
+    //! Return the filter that is effectively used for values of the given precision
+    PreFilter for_precision(const DynamicPrecision& prec) const {
+        return {.shuffle = prec.size_in_bytes() > 1 || shuffle == Shuffle::bit ? shuffle : Shuffle::none,
+                .delta = delta && prec.is_integral()};
+    }
+};
+
+inline constexpr PreFilter byte_shuffle{.shuffle = Shuffle::byte};  //!< Byte shuffle filter
+inline constexpr PreFilter bit_shuffle{.shuffle = Shuffle::bit};  //!< Bit shuffle filter
+inline constexpr PreFilter delta{.delta = true};  //!< Delta filter (for integral arrays)
+
+//! Return a string representation of the filter (e.g. for storing it in file headers)
+inline std::string as_string(const PreFilter& filter) {
+    std::string result = filter.delta ? "delta" : "";
+    if (filter.shuffle != Shuffle::none)
+        result += (result.empty() ? "" : ",") + std::string{filter.shuffle == Shuffle::byte ? "byte_shuffle" : "bit_shuffle"};
+    return result;
+}
+
+//! Create a filter from its string representation (see as_string())
+inline PreFilter pre_filter_from_string(const std::string& filter) {
+    PreFilter result;
+    std::size_t begin = 0;
+    while (begin < filter.size()) {
+        const auto end = std::min(filter.find(',', begin), filter.size());
+        const auto name = filter.substr(begin, end - begin);
+        if (name == "delta") result.delta = true;
+        else if (name == "byte_shuffle") result.shuffle = Shuffle::byte;
+        else if (name == "bit_shuffle") result.shuffle = Shuffle::bit;
+        else if (!name.empty()) throw ValueError("Unknown pre-filter '" + name + "'");
+        begin = end + 1;
+    }
+    return result;
+}
+
+#ifndef DOXYGEN
+namespace PreFilterDetail {
+
+    // transpose the 8x8 bit matrix whose rows are the bytes of x
+    inline std::uint64_t transpose_8x8_bits(std::uint64_t x) {
+        std::uint64_t t;
+        t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL; x = x ^ t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL; x = x ^ t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL; x = x ^ t ^ (t << 28);
+        return x;
+    }
+
+    // out[j*n + i] = in[i*k + j] for n values with k bytes
+    inline void shuffle_bytes(std::span<const std::byte> in, std::span<std::byte> out, std::size_t k) {
+        const std::size_t n = in.size()/k;
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < k; ++j)
+                out[j*n + i] = in[i*k + j];
+    }
+
+    inline void unshuffle_bytes(std::span<const std::byte> in, std::span<std::byte> out, std::size_t k) {
+        const std::size_t n = in.size()/k;
+        for (std::size_t j = 0; j < k; ++j)
+            for (std::size_t i = 0; i < n; ++i)
+                out[i*k + j] = in[j*n + i];
+    }
+
+    // Writes the bit planes of groups of eight values: bit b of byte j of all values is stored
+    // in plane 8*j + b. Values exceeding a multiple of eight are copied as they are.
+    inline void shuffle_bits(std::span<const std::byte> in, std::span<std::byte> out, std::size_t k) {
+        const std::size_t num_groups = in.size()/k/8;
+        const std::size_t plane_size = num_groups;
+        for (std::size_t j = 0; j < k; ++j)
+            for (std::size_t g = 0; g < num_groups; ++g) {
+                std::uint64_t x = 0;
+                for (std::size_t t = 0; t < 8; ++t)
+                    x |= static_cast<std::uint64_t>(in[(8*g + t)*k + j]) << (8*t);
+                x = transpose_8x8_bits(x);
+                for (std::size_t b = 0; b < 8; ++b)
+                    out[(8*j + b)*plane_size + g] = static_cast<std::byte>(x >> (8*b));
+            }
+        const std::size_t shuffled = num_groups*8*k;
+        std::copy(in.begin() + shuffled, in.end(), out.begin() + shuffled);
+    }
+
+    inline void unshuffle_bits(std::span<const std::byte> in, std::span<std::byte> out, std::size_t k) {
+        const std::size_t num_groups = in.size()/k/8;
+        const std::size_t plane_size = num_groups;
+        for (std::size_t j = 0; j < k; ++j)
+            for (std::size_t g = 0; g < num_groups; ++g) {
+                std::uint64_t x = 0;
+                for (std::size_t b = 0; b < 8; ++b)
+                    x |= static_cast<std::uint64_t>(in[(8*j + b)*plane_size + g]) << (8*b);
+                x = transpose_8x8_bits(x);
+                for (std::size_t t = 0; t < 8; ++t)
+                    out[(8*g + t)*k + j] = static_cast<std::byte>(x >> (8*t));
+            }
+        const std::size_t shuffled = num_groups*8*k;
+        std::copy(in.begin() + shuffled, in.end(), out.begin() + shuffled);
+    }
+
+    // invoke the action with an unsigned integer type of the given size (wrap-around arithmetic
+    // on unsigned values yields the same bit patterns as for the signed counterparts)
+    template<typename Action>
+    void visit_unsigned_of_size(std::size_t size, const Action& action) {
+        switch (size) {
+            case 1: action(std::uint8_t{}); break;
+            case 2: action(std::uint16_t{}); break;
+            case 4: action(std::uint32_t{}); break;
+            case 8: action(std::uint64_t{}); break;
+            default: throw NotImplemented("Delta filter not implemented for values with " + std::to_string(size) + " bytes");
+        }
+    }
+
+    template<typename Transform>
+    void transform_bytes(Serialization& data, std::size_t value_size, const Transform& transform) {
+        if (value_size == 0 || data.size()%value_size != 0)
+            throw SizeError("Number of bytes is not a multiple of the value size");
+        std::vector<std::byte> tmp(data.size());
+        transform(std::span<const std::byte>{data.as_span()}, std::span{tmp}, value_size);
+        std::ranges::copy(tmp, data.as_span().begin());
+    }
+
+}  // namespace PreFilterDetail
+#endif  // DOXYGEN
+
+//! Apply the shuffle step of a filter to data consisting of values with the given number of bytes
+inline void shuffle(Shuffle s, Serialization& data, std::size_t value_size) {
+    if (s == Shuffle::byte && value_size > 1)
+        PreFilterDetail::transform_bytes(data, value_size, PreFilterDetail::shuffle_bytes);
+    else if (s == Shuffle::bit)
+        PreFilterDetail::transform_bytes(data, value_size, PreFilterDetail::shuffle_bits);
+}
+
+//! Undo the shuffle step of a filter on data consisting of values with the given number of bytes
+inline void unshuffle(Shuffle s, Serialization& data, std::size_t value_size) {
+    if (s == Shuffle::byte && value_size > 1)
+        PreFilterDetail::transform_bytes(data, value_size, PreFilterDetail::unshuffle_bytes);
+    else if (s == Shuffle::bit)
+        PreFilterDetail::transform_bytes(data, value_size, PreFilterDetail::unshuffle_bits);
+}
+
+//! Replace the (native-endian) integer values of the given size by the differences to their predecessors
+inline void delta_encode(Serialization& data, std::size_t value_size) {
+    PreFilterDetail::visit_unsigned_of_size(value_size, [&] <typename T> (T) {
+        auto values = data.as_span_of(Precision<T>{});
+        for (std::size_t i = values.size(); i > 1; --i)
+            values[i-1] = static_cast<T>(values[i-1] - values[i-2]);
+    });
+}
+
+//! Undo the delta encoding of (native-endian) integer values of the given size
+inline void delta_decode(Serialization& data, std::size_t value_size) {
+    PreFilterDetail::visit_unsigned_of_size(value_size, [&] <typename T> (T) {
+        auto values = data.as_span_of(Precision<T>{});
+        for (std::size_t i = 1; i < values.size(); ++i)
+            values[i] = static_cast<T>(values[i] + values[i-1]);
+    });
+}
+
+/*!
+ * \brief Apply the filter to the given data, consisting of values with the given precision.
+ * \note Delta encoding is only applied to integral values (see PreFilter::for_precision()).
+ */
+inline void apply_pre_filter(const PreFilter& filter, Serialization& data, const DynamicPrecision& prec) {
+    const auto effective = filter.for_precision(prec);
+    if (effective.delta)
+        delta_encode(data, prec.size_in_bytes());
+    shuffle(effective.shuffle, data, prec.size_in_bytes());
+}
+
+/*!
+ * \brief Undo the filter on the given data, consisting of native-endian values with the given precision.
+ * \note When reading data with non-native byte order, the data has to be unshuffled before and
+ *       delta-decoded after changing the byte order (see unshuffle() and delta_decode()).
+ */
+inline void undo_pre_filter(const PreFilter& filter, Serialization& data, const DynamicPrecision& prec) {
+    const auto effective = filter.for_precision(prec);
+    unshuffle(effective.shuffle, data, prec.size_in_bytes());
+    if (effective.delta)
+        delta_decode(data, prec.size_in_bytes());
+}
+
+//! \} group Compression
+
+}  // namespace GridFormat::Compression
+
+#endif  // GRIDFORMAT_COMPRESSION_PRE_FILTER_HPP_
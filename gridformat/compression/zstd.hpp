@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \ingroup Compression
+ * \brief Compressor using the Zstandard library.
+ */
+#ifndef GRIDFORMAT_COMPRESSION_ZSTD_HPP_
+#define GRIDFORMAT_COMPRESSION_ZSTD_HPP_
+#if GRIDFORMAT_HAVE_ZSTD
+
+#include <concepts>
+#include <utility>
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include <tuple>
+
+#include <zstd.h>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/common/logging.hpp>
+
+#include <gridformat/compression/common.hpp>
+#include <gridformat/compression/decompress.hpp>
+
+namespace GridFormat::Compression {
+
+//! \addtogroup Compression
+//! @{
+
+//! Options for the zstd compressor
+struct ZSTDOptions {
+    std::size_t block_size = default_block_size;
+    int compression_level = ZSTD_CLEVEL_DEFAULT;
+    bool long_distance_matching = false;  //!< only has an effect for block sizes beyond the default window size
+    int window_log = 0;  //!< base-2 logarithm of the match window size (0 = chosen by zstd)
+};
+
+//! Compressor using the Zstandard (zstd) compression library
+class ZSTD {
+    using ZSTDByte = char;
+    static_assert(sizeof(typename Serialization::Byte) == sizeof(ZSTDByte));
+
+    struct BlockDecompressor {
+        using ByteType = ZSTDByte;
+
+        BlockDecompressor()
+        : _context{ZSTD_createDCtx(), &ZSTD_freeDCtx} {
+            if (!_context)
+                throw InvalidState(as_error("(ZSTDCompressor) Could not create decompression context"));
+            // allow decompressing blocks written with long-distance matching and large windows
+            const auto max_window_log = ZSTD_dParam_getBounds(ZSTD_d_windowLogMax).upperBound;
+            _check(ZSTD_DCtx_setParameter(_context.get(), ZSTD_d_windowLogMax, max_window_log));
+        }
+
+        void operator()(std::span<const ByteType> in, std::span<ByteType> out) const {
+            const std::size_t decompressed_length = ZSTD_decompressDCtx(
+                _context.get(),
+                out.data(), out.size(),
+                in.data(), in.size()
+            );
+            if (ZSTD_isError(decompressed_length))
+                throw IOError(std::string{"(ZSTDCompressor) Error upon block decompression: "}
+                              + ZSTD_getErrorName(decompressed_length));
+            if (decompressed_length != out.size())
+                throw IOError("(ZSTDCompressor) Unexpected decompressed size");
+        }
+
+     private:
+        std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> _context;
+    };
+
+ public:
+    using Options = ZSTDOptions;
+
+    explicit constexpr ZSTD(Options opts = {})
+    : _opts(std::move(opts))
+    {}
+
+    template<std::integral HeaderType = std::size_t>
+    CompressedBlocks<HeaderType> compress(Serialization& in) const {
+        if (std::numeric_limits<HeaderType>::max() < in.size())
+            throw TypeError("Chosen HeaderType is too small for given number of bytes");
+        if (std::numeric_limits<HeaderType>::max() < _opts.block_size)
+            throw TypeError("Chosen HeaderType is too small for given block size");
+
+        auto [blocks, out] = _compress<HeaderType>(in.template as_span_of<const ZSTDByte>());
+        in = std::move(out);
+        in.resize(blocks.compressed_size());
+        return blocks;
+    }
+
+    template<std::integral HeaderType>
+    static void decompress(Serialization& in, const CompressedBlocks<HeaderType>& blocks) {
+        Compression::decompress(in, blocks, BlockDecompressor{});
+    }
+
+    static ZSTD with(Options opts) {
+        return ZSTD{std::move(opts)};
+    }
+
+ private:
+    static void _check(std::size_t zstd_result) {
+        if (ZSTD_isError(zstd_result))
+            throw InvalidState(as_error(
+                std::string{"(ZSTDCompressor) "} + ZSTD_getErrorName(zstd_result)
+            ));
+    }
+
+    auto _make_compression_context() const {
+        std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+        if (!context)
+            throw InvalidState(as_error("(ZSTDCompressor) Could not create compression context"));
+        _check(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, _opts.compression_level));
+        _check(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_enableLongDistanceMatching, _opts.long_distance_matching ? 1 : 0));
+        if (_opts.window_log != 0)
+            _check(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_windowLog, _opts.window_log));
+        return context;
+    }
+
+    template<std::integral HeaderType>
+    auto _compress(std::span<const ZSTDByte> in) const {
+        HeaderType block_size = static_cast<HeaderType>(_opts.block_size);
+        HeaderType size_in_bytes = static_cast<HeaderType>(in.size());
+        Blocks<HeaderType> blocks{size_in_bytes, block_size};
+
+        const auto context = _make_compression_context();
+        const std::size_t max_block_out_size = ZSTD_compressBound(_opts.block_size);
+
+        Serialization compressed;
+        std::vector<HeaderType> compressed_block_sizes;
+        compressed_block_sizes.reserve(blocks.number_of_blocks);
+        compressed.resize(max_block_out_size*blocks.number_of_blocks);
+
+        HeaderType cur_in = 0;
+        HeaderType cur_out = 0;
+        auto out = compressed.template as_span_of<ZSTDByte>();
+        while (cur_in < size_in_bytes) {
+            using std::min;
+            const HeaderType cur_block_size = min(block_size, size_in_bytes - cur_in);
+            assert(cur_in + cur_block_size <= size_in_bytes);
+            assert(cur_out + max_block_out_size <= out.size());
+
+            // compress directly into the output buffer (its capacity suffices for all blocks)
+            const std::size_t compressed_length = ZSTD_compress2(
+                context.get(),
+                out.data() + cur_out, max_block_out_size,
+                in.data() + cur_in, cur_block_size
+            );
+            _check(compressed_length);
+
+            cur_in += cur_block_size;
+            cur_out += static_cast<HeaderType>(compressed_length);
+            compressed_block_sizes.push_back(static_cast<HeaderType>(compressed_length));
+        }
+
+        if (cur_in != size_in_bytes)
+            throw InvalidState(as_error("(ZSTDCompressor) unexpected number of bytes processed"));
+
+        return std::make_tuple(
+            CompressedBlocks<HeaderType>{blocks, std::move(compressed_block_sizes)},
+            compressed
+        );
+    }
+
+    Options _opts;
+};
+
+inline constexpr ZSTD zstd;  //!< Instance of the zstd compressor
+
+#ifndef DOXYGEN
+namespace Detail { inline constexpr bool _have_zstd = true; }
+#endif  // DOXYGEN
+
+//! @} group Compression
+
+}  // end namespace GridFormat::Compression
+
+#else  // GRIDFORMAT_HAVE_ZSTD
+
+namespace GridFormat::Compression {
+
+namespace Detail { inline constexpr bool _have_zstd = false; }
+
+class ZSTD {
+ public:
+    template<bool b = false, typename... Args>
+    explicit ZSTD(Args&&...) { static_assert(b, "ZSTD compressor requires the zstd library."); }
+};
+
+}  // namespace GridFormat::Compression
+
+#endif  // GRIDFORMAT_HAVE_ZSTD
+#endif  // GRIDFORMAT_COMPRESSION_ZSTD_HPP_
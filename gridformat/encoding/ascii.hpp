@@ -15,13 +15,16 @@
 #include <optional>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <span>
-#include <sstream>
-
-#if __has_include(<format>)
-#include <format>
-#endif
-
+#include <array>
+#include <vector>
+#include <charconv>
+#include <system_error>
+#include <type_traits>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/concurrency.hpp>
 #include <gridformat/common/output_stream.hpp>
 #include <gridformat/common/reserved_string.hpp>
 
@@ -35,6 +38,28 @@ namespace GridFormat::Encoding::Detail {
     template<std::unsigned_integral T>
     struct AsciiPrintType<T> : std::type_identity<std::uintmax_t> {};
 
+    // minimum number of values formatted per thread (to amortize the cost of spawning threads)
+    inline constexpr std::size_t min_ascii_values_per_thread = 1 << 16;
+
+    template<typename T>
+    void append_formatted(std::string& out, const T value, [[maybe_unused]] const int precision) {
+        std::array<char, 64> buffer;
+        std::to_chars_result result;
+        if constexpr (std::floating_point<T>) {
+            if (precision < 0)
+                result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            else
+                result = std::to_chars(
+                    buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, precision
+                );
+        } else {
+            result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        }
+        if (result.ec != std::errc{})
+            throw ValueError("Could not format value for ascii output");
+        out.append(buffer.data(), result.ptr);
+    }
+
 }  // namespace GridFormat::Encoding::Detail
 #endif  // DOXYGEN
 
@@ -49,69 +74,29 @@ struct AsciiFormatOptions {
     ReservedString<30> line_prefix{""};
     std::size_t entries_per_line = std::numeric_limits<std::size_t>::max();
     std::size_t num_cached_lines = 100; //!< Number of line cached between flushing the buffer
+    bool shortest_round_trip = false; //!< Print floating-point values with the shortest representation that reads back exactly
+    std::size_t num_threads = 1; //!< Maximum number of threads used to format large ranges
 
     friend bool operator==(const AsciiFormatOptions& a, const AsciiFormatOptions& b) {
         return a.delimiter == b.delimiter
             && a.line_prefix == b.line_prefix
             && a.entries_per_line == b.entries_per_line
-            && a.num_cached_lines == b.num_cached_lines;
+            && a.num_cached_lines == b.num_cached_lines
+            && a.shortest_round_trip == b.shortest_round_trip
+            && a.num_threads == b.num_threads;
     }
 };
 
-//! Wrapper around a given stream to write formatted ascii output
+/*!
+ * \brief Wrapper around a given stream to write formatted ascii output
+ * \note Values are formatted with `std::to_chars`. Floating-point values are printed
+ *       with `digits10` significant digits, or with the shortest representation that
+ *       reads back exactly if `AsciiFormatOptions::shortest_round_trip` is set. Large
+ *       ranges may be formatted in chunks of lines on multiple threads (see
+ *       `AsciiFormatOptions::num_threads`), which are then written in order.
+ */
 template<typename OStream>
 class AsciiOutputStream : public OutputStreamWrapperBase<OStream> {
-    class Buffer {
-     public:
-        Buffer(std::streamsize precision)
-        : _precision{precision} {
-            _init_stream_buf();
-        }
-
-        template<typename V, typename D>
-        void push(V&& value, D&& delimiter) {
-#if __cpp_lib_format
-            if constexpr (std::floating_point<std::remove_cvref_t<V>>)
-                std::format_to(std::back_inserter(_string_buf),
-                    "{:.{}g}{}", std::forward<V>(value), _precision, std::forward<D>(delimiter)
-                );
-            else
-                std::format_to(std::back_inserter(_string_buf),
-                    "{}{}", std::forward<V>(value), std::forward<D>(delimiter)
-                );
-#else
-            _stream_buf << std::forward<V>(value) << std::forward<D>(delimiter);
-#endif
-        }
-
-        void prepare_readout() {
-#if !__cpp_lib_format
-            // move internal string buffer out of the stream
-            // (see https://stackoverflow.com/a/66662433)
-            _string_buf = std::move(_stream_buf).str();
-            _init_stream_buf(); // reinitialize
-#endif
-        }
-
-        auto data() const {
-            return std::span{_string_buf.data(), _string_buf.size()};
-        }
-
-        void clear() {
-            _string_buf.clear();
-        }
-
-     private:
-        void _init_stream_buf() {
-            _stream_buf = {};
-            _stream_buf.precision(_precision);
-        }
-
-        std::streamsize _precision;
-        std::string _string_buf;
-        std::ostringstream _stream_buf;
-    };
-
  public:
     AsciiOutputStream(OStream& s, AsciiFormatOptions opts = {})
     : OutputStreamWrapperBase<OStream>(s)
@@ -120,35 +105,60 @@ class AsciiOutputStream : public OutputStreamWrapperBase<OStream> {
 
     template<typename T, std::size_t size>
     void write(std::span<T, size> data) {
-        std::size_t count_entries = 0;
-        std::size_t count_buffer_lines = 0;
+        if (data.empty())
+            return;
+
+        using std::min;
+        using std::max;
+        const std::size_t entries_per_line = max(_opts.entries_per_line, std::size_t{1});
+        const std::size_t num_lines = data.size()/entries_per_line + (data.size()%entries_per_line > 0 ? 1 : 0);
+        const std::size_t lines_per_task = max(
+            max(_opts.num_cached_lines, std::size_t{1}),
+            _opts.num_threads > 1 ? Encoding::Detail::min_ascii_values_per_thread/entries_per_line : std::size_t{0}
+        );
+        const std::size_t num_tasks = num_lines/lines_per_task + (num_lines%lines_per_task > 0 ? 1 : 0);
+        const std::size_t num_threads = max(min(_opts.num_threads, num_tasks), std::size_t{1});
+
+        std::vector<std::string> buffers(num_threads);
+        for (std::size_t task = 0; task < num_tasks; task += num_threads) {
+            const std::size_t num_batch_tasks = min(num_threads, num_tasks - task);
+            const auto format_task = [&] (std::size_t i) {
+                const std::size_t first_line = (task + i)*lines_per_task;
+                const std::size_t last_line = min(first_line + lines_per_task, num_lines);
+                buffers[i].clear();
+                _format_lines(data, first_line, last_line, entries_per_line, buffers[i]);
+            };
+
+            run_concurrently(num_batch_tasks, format_task);
+            for (std::size_t i = 0; i < num_batch_tasks; ++i)
+                this->_write_raw(std::span{buffers[i].data(), buffers[i].size()});
+        }
+    }
 
-        using PrintType = typename Encoding::Detail::AsciiPrintType<T>::type;
-        Buffer buffer(std::numeric_limits<PrintType>::digits10);
-        while (count_entries < data.size()) {
-            buffer.push(count_entries > 0 ? "\n" : "", _opts.line_prefix);
+ private:
+    template<typename T, std::size_t size>
+    void _format_lines(std::span<T, size> data,
+                       const std::size_t first_line,
+                       const std::size_t last_line,
+                       const std::size_t entries_per_line,
+                       std::string& out) const {
+        using PrintType = typename Encoding::Detail::AsciiPrintType<std::remove_cv_t<T>>::type;
+        const int precision = _opts.shortest_round_trip ? -1 : std::numeric_limits<PrintType>::digits10;
+        const std::string_view delimiter = _opts.delimiter;
+        const std::string_view line_prefix = _opts.line_prefix;
+        for (std::size_t line = first_line; line < last_line; ++line) {
+            if (line > 0)
+                out.push_back('\n');
+            out.append(line_prefix);
 
             using std::min;
-            const auto num_entries = min(_opts.entries_per_line, data.size() - count_entries);
-            for (const auto& value : data.subspan(count_entries, num_entries))
-                buffer.push(static_cast<PrintType>(value), _opts.delimiter);
-
-            // update counters
-            count_entries += num_entries;
-            ++count_buffer_lines;
-
-            // flush and reset buffer
-            if (count_buffer_lines >= _opts.num_cached_lines) {
-                buffer.prepare_readout();
-                this->_write_raw(buffer.data());
-                buffer.clear();
-                count_buffer_lines = 0;
+            const std::size_t begin = line*entries_per_line;
+            const std::size_t end = min(begin + entries_per_line, data.size());
+            for (std::size_t i = begin; i < end; ++i) {
+                Encoding::Detail::append_formatted(out, static_cast<PrintType>(data[i]), precision);
+                out.append(delimiter);
             }
         }
-
-        // flush remaining buffer content
-        buffer.prepare_readout();
-        this->_write_raw(buffer.data());
     }
 
     AsciiFormatOptions _opts;
@@ -90,6 +90,36 @@ namespace GridFormat::GridDetail {
             { Traits::NumberOfCellPoints<T, Cell<T>>::get(grid, cell) } -> std::convertible_to<std::size_t>;
         };
 
+    template<typename T>
+    concept SizedContiguousRange = std::ranges::contiguous_range<T> and std::ranges::sized_range<T>;
+
+    template<typename T>
+    concept ExposesCoordinates = is_complete<Traits::Coordinates<T>> && ExposesPointCoordinates<T> && requires(const T& grid) {
+        { Traits::Coordinates<T>::get(grid) } -> SizedContiguousRange;
+        requires Concepts::Scalar<std::ranges::range_value_t<decltype(Traits::Coordinates<T>::get(grid))>>;
+    };
+
+    template<typename T>
+    concept ExposesConnectivity = is_complete<Traits::Connectivity<T>> && requires(const T& grid) {
+        { Traits::Connectivity<T>::get(grid) } -> SizedContiguousRange;
+        requires std::integral<std::ranges::range_value_t<decltype(Traits::Connectivity<T>::get(grid))>>;
+    };
+
+    template<typename T>
+    concept ExposesOffsets = is_complete<Traits::Offsets<T>> && requires(const T& grid) {
+        { Traits::Offsets<T>::get(grid) } -> SizedContiguousRange;
+        requires std::integral<std::ranges::range_value_t<decltype(Traits::Offsets<T>::get(grid))>>;
+    };
+
+    template<typename T>
+    concept ExposesCellTypes = is_complete<Traits::CellTypes<T>> && requires(const T& grid) {
+        { Traits::CellTypes<T>::get(grid) } -> SizedContiguousRange;
+        requires std::same_as<
+            std::ranges::range_value_t<decltype(Traits::CellTypes<T>::get(grid))>,
+            GridFormat::CellType
+        >;
+    };
+
     template<typename T>
     concept ExposesOrigin = is_complete<Traits::Origin<T>> && requires(const T& grid) {
         { Traits::Origin<T>::get(grid) } -> Concepts::StaticallySizedMDRange<1>;
@@ -8,16 +8,24 @@
 #ifndef GRIDFORMAT_GRID_CONVERTER_HPP_
 #define GRIDFORMAT_GRID_CONVERTER_HPP_
 
+#include <span>
 #include <array>
+#include <string>
 #include <vector>
 #include <ranges>
+#include <future>
 #include <concepts>
 #include <utility>
 #include <numeric>
 #include <optional>
 #include <cstdint>
+#include <algorithm>
 
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/ranges.hpp>
+#include <gridformat/common/concepts.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/serialization.hpp>
 #include <gridformat/common/exceptions.hpp>
 
 #include <gridformat/grid/cell_type.hpp>
@@ -29,18 +37,64 @@ namespace GridFormat {
 #ifndef DOXYGEN
 namespace ConverterDetail {
 
+    /*!
+     * \brief Grid exposing the data of a reader to writers.
+     * \details The coordinates are stored in the precision given by `CoordinateType`, and the
+     *          cells are stored in flat (CSR-like) connectivity, offsets and types arrays.
+     */
+    template<Concepts::Scalar CoordinateType = double>
     struct ConverterGrid {
         const GridReader& reader;
-        std::vector<std::array<double, 3>> points;
-        std::vector<std::pair<CellType, std::vector<std::size_t>>> cells;
+        Serialization coordinates;  // three values per point
+        std::vector<std::size_t> connectivity;
+        std::vector<std::size_t> offsets;  // offset past the last corner of each cell
+        std::vector<CellType> types;
 
         explicit ConverterGrid(const GridReader& r) : reader{r} {}
 
         void make_grid() {
-            points.clear();
-            cells.clear();
+            coordinates.resize(0);
+            connectivity.clear();
+            offsets.clear();
+            types.clear();
             _make_points();
             _make_cells();
+            _has_grid = true;
+        }
+
+        // take over the grid data of another instance (e.g. one that was filled ahead of time)
+        void take_grid_from(ConverterGrid&& other) {
+            coordinates = std::move(other.coordinates);
+            connectivity = std::move(other.connectivity);
+            offsets = std::move(other.offsets);
+            types = std::move(other.types);
+            _has_grid = std::exchange(other._has_grid, false);
+        }
+
+        bool has_same_grid_as(const ConverterGrid& other) const {
+            return _has_grid && other._has_grid
+                && std::ranges::equal(coordinates.as_span(), other.coordinates.as_span())
+                && connectivity == other.connectivity
+                && offsets == other.offsets
+                && types == other.types;
+        }
+
+        // once the grid is made, the numbers of entities are independent of the current state of the reader
+        std::size_t number_of_points() const {
+            return _has_grid ? coordinates.size()/(3*sizeof(CoordinateType)) : reader.number_of_points();
+        }
+
+        std::size_t number_of_cells() const {
+            return _has_grid ? types.size() : reader.number_of_cells();
+        }
+
+        std::span<const CoordinateType> coordinates_span() const {
+            return coordinates.as_span_of(Precision<CoordinateType>{});
+        }
+
+        std::span<const std::size_t> corners(std::size_t cell_index) const {
+            const std::size_t begin = cell_index == 0 ? 0 : offsets.at(cell_index - 1);
+            return std::span{connectivity}.subspan(begin, offsets.at(cell_index) - begin);
         }
 
      private:
@@ -51,28 +105,56 @@ namespace ConverterDetail {
             const auto in_dim = in_layout.dimension() > 1 ? in_layout.extent(1) : 0;
             if (in_np != reader.number_of_points())
                 throw SizeError("Mismatch between stored and defined number of points.");
+            if (in_dim > 3)
+                throw SizeError("Points with more than three coordinates are not supported.");
+
+            // take over the data as is if it matches the stored layout & precision
+            if (in_dim == 3 && in_points->precision().template is<CoordinateType>()) {
+                coordinates = in_points->serialized();
+                return;
+            }
 
-            points.reserve(in_np);
+            coordinates.resize(in_np*3*sizeof(CoordinateType));
+            auto out = coordinates.as_span_of(Precision<CoordinateType>{});
             in_points->visit_field_values([&] <typename T> (std::span<const T> values) {
-                std::ranges::for_each(std::views::iota(std::size_t{0}, in_np), [&] (auto p_idx) {
-                    points.push_back({});
-                    std::ranges::for_each(std::views::iota(std::size_t{0}, in_dim), [&] (auto dim) {
-                        points.back().at(dim) = static_cast<double>(values[p_idx*in_dim + dim]);
-                    });
-                });
+                for (std::size_t p_idx = 0; p_idx < in_np; ++p_idx)
+                    for (std::size_t dim = 0; dim < in_dim; ++dim)
+                        out[p_idx*3 + dim] = static_cast<CoordinateType>(values[p_idx*in_dim + dim]);
             });
         }
 
         void _make_cells() {
-            cells.reserve(reader.number_of_cells());
-            reader.visit_cells([&] (CellType ct, std::vector<std::size_t> corners) {
-                cells.emplace_back(std::pair{std::move(ct), std::move(corners)});
+            const auto num_cells = reader.number_of_cells();
+            offsets.reserve(num_cells);
+            types.reserve(num_cells);
+            reader.visit_cells([&] (CellType ct, const std::vector<std::size_t>& corners) {
+                connectivity.insert(connectivity.end(), corners.begin(), corners.end());
+                offsets.push_back(connectivity.size());
+                types.push_back(ct);
             });
-            if (cells.size() != reader.number_of_cells())
+            if (types.size() != num_cells)
                 throw SizeError("Mismatch between stored and defined number of cells.");
         }
+
+        bool _has_grid = false;
     };
 
+    template<typename G>
+    inline constexpr bool is_converter_grid = false;
+    template<typename T>
+    inline constexpr bool is_converter_grid<ConverterGrid<T>> = true;
+
+    // Invoke the action with a converter grid whose coordinate type matches the precision of the points
+    template<typename Action>
+    decltype(auto) visit_converter_grid(const GridReader& reader, const Action& action) {
+        if (reader.points()->precision().template is<float>()) {
+            ConverterGrid<float> grid{reader};
+            return action(grid);
+        }
+        ConverterGrid<double> grid{reader};
+        return action(grid);
+    }
+
     template<typename T>
     concept Writer
         = requires { typename std::remove_cvref_t<T>::Grid; }
@@ -85,12 +167,12 @@ namespace ConverterDetail {
     concept TimeSeriesWriter = Writer<T> and std::derived_from<std::remove_cvref_t<T>, TimeSeriesGridWriter<typename T::Grid>>;
 
     template<typename T>
-    concept PieceWriterFactory = requires (const T& factory, const ConverterGrid& grid) {
+    concept PieceWriterFactory = requires (const T& factory, const ConverterGrid<>& grid) {
         { factory(grid) } -> PieceWriter;
     };
 
     template<typename T>
-    concept TimeSeriesWriterFactory = requires (const T& factory, const ConverterGrid& grid, const std::string& filename) {
+    concept TimeSeriesWriterFactory = requires (const T& factory, const ConverterGrid<>& grid, const std::string& filename) {
         { factory(grid) } -> TimeSeriesWriter;
     };
 
@@ -108,6 +190,47 @@ namespace ConverterDetail {
             writer.set_meta_data(std::move(name), std::move(field_ptr));
     }
 
+    // Grid and fields of a step of a sequence, read while the previous step is being written
+    template<typename CoordinateType>
+    struct PrefetchedStep {
+        using Fields = std::vector<std::pair<std::string, FieldPtr>>;
+
+        ConverterGrid<CoordinateType> grid;
+        Fields cell_fields = {};
+        Fields point_fields = {};
+        Fields meta_data_fields = {};
+        double time = 0.0;
+    };
+
+    template<typename CoordinateType>
+    PrefetchedStep<CoordinateType> prefetch_step(GridReader& reader, std::size_t step) {
+        reader.set_step(step);
+        PrefetchedStep<CoordinateType> result{.grid = ConverterGrid<CoordinateType>{reader}};
+        result.time = reader.time_at_step(step);
+        result.grid.make_grid();
+        const auto collect = [] (std::ranges::range auto&& fields, auto& out) {
+            for (auto [name, field_ptr] : fields) {
+                field_ptr->prefetch();
+                out.emplace_back(std::move(name), std::move(field_ptr));
+            }
+        };
+        collect(cell_fields(reader), result.cell_fields);
+        collect(point_fields(reader), result.point_fields);
+        collect(meta_data_fields(reader), result.meta_data_fields);
+        return result;
+    }
+
+    template<typename CoordinateType, Writer Writer>
+    void add_piece_fields(const PrefetchedStep<CoordinateType>& step, Writer& writer) {
+        writer.clear();
+        for (const auto& [name, field_ptr] : step.cell_fields)
+            writer.set_cell_field(name, field_ptr);
+        for (const auto& [name, field_ptr] : step.point_fields)
+            writer.set_point_field(name, field_ptr);
+        for (const auto& [name, field_ptr] : step.meta_data_fields)
+            writer.set_meta_data(name, field_ptr);
+    }
+
     template<typename Reader, PieceWriter Writer>
     std::string write_piece(const Reader& reader, Writer& writer, const std::string& filename) {
         add_piece_fields(reader, writer);
@@ -132,13 +255,14 @@ namespace ConverterDetail {
  */
 template<std::derived_from<GridReader> Reader, ConverterDetail::WriterFactory Factory>
 std::string convert(const Reader& reader, const std::string& filename, const Factory& factory) {
-    ConverterDetail::ConverterGrid grid{reader};
-    auto writer = factory(grid);
-    if (reader.filename() == filename + writer.extension())
-        throw GridFormat::IOError("Cannot read/write from/to the same file");
-    if constexpr (Traits::WritesConnectivity<std::remove_cvref_t<decltype(writer)>>::value)
-        grid.make_grid();
-    return ConverterDetail::write_piece(reader, writer, filename);
+    return ConverterDetail::visit_converter_grid(reader, [&] (auto& grid) {
+        auto writer = factory(grid);
+        if (reader.filename() == filename + writer.extension())
+            throw GridFormat::IOError("Cannot read/write from/to the same file");
+        if constexpr (Traits::WritesConnectivity<std::remove_cvref_t<decltype(writer)>>::value)
+            grid.make_grid();
+        return ConverterDetail::write_piece(reader, writer, filename);
+    });
 }
 
 /*!
@@ -157,141 +281,225 @@ std::string convert(Reader& reader,
     if (!reader.is_sequence())
         throw ValueError("Cannot convert data from reader to a sequence as the file read is no sequence.");
 
-    ConverterDetail::ConverterGrid grid{reader};
-    auto writer = factory(grid);
-    std::string filename;
-    for (std::size_t step = 0; step < reader.number_of_steps(); ++step) {
-        reader.set_step(step);
-        if constexpr (Traits::WritesConnectivity<std::remove_cvref_t<decltype(writer)>>::value)
-            grid.make_grid();
-        filename = ConverterDetail::write_piece(reader, writer, reader.time_at_step(step));
-        call_back(step, filename);
-    }
-    return filename;
+    return ConverterDetail::visit_converter_grid(reader, [&] (auto& grid) {
+        auto writer = factory(grid);
+        std::string filename;
+        for (std::size_t step = 0; step < reader.number_of_steps(); ++step) {
+            reader.set_step(step);
+            if constexpr (Traits::WritesConnectivity<std::remove_cvref_t<decltype(writer)>>::value)
+                grid.make_grid();
+            filename = ConverterDetail::write_piece(reader, writer, reader.time_at_step(step));
+            call_back(step, filename);
+        }
+        return filename;
+    });
+}
+
+/*!
+ * \ingroup Grid
+ * \brief Overload for time series formats that reads the next step while the current one is written.
+ * \details The grid and the fields of step `i+1` are read (and decoded) on a separate thread while
+ *          step `i` is written. If the grid of a step is identical to the one of the previous step,
+ *          the writer keeps operating on the previous grid data.
+ * \note The reader is accessed on a different thread than the writer, and thus, reader and writer
+ *       must not rely on non-thread-safe library state (e.g. HDF5 libraries built without thread
+ *       safety) or issue concurrent communication. For writers that do not write connectivity
+ *       (i.e. structured grids), this falls back to the non-pipelined conversion.
+ * \param reader A grid reader on which a file was opened.
+ * \param factory A factory to construct a time series writer with the desired output format.
+ * \param call_back (optional) A callback that is invoked after writing each step.
+ */
+template<std::derived_from<GridReader> Reader,
+         ConverterDetail::TimeSeriesWriterFactory Factory,
+         std::invocable<std::size_t, const std::string&> StepCallBack = decltype([] (std::size_t, const std::string&) {})>
+std::string convert_pipelined(Reader& reader,
+                              const Factory& factory,
+                              const StepCallBack& call_back = {}) {
+    if (!reader.is_sequence())
+        throw ValueError("Cannot convert data from reader to a sequence as the file read is no sequence.");
+
+    return ConverterDetail::visit_converter_grid(reader, [&] <typename CT> (ConverterDetail::ConverterGrid<CT>& grid) {
+        using Writer = std::remove_cvref_t<decltype(factory(grid))>;
+        if constexpr (!Traits::WritesConnectivity<Writer>::value) {
+            return convert(reader, factory, call_back);
+        } else {
+            auto writer = factory(grid);
+            const auto num_steps = reader.number_of_steps();
+            auto next = std::async(std::launch::async, [&] () {
+                return ConverterDetail::prefetch_step<CT>(reader, 0);
+            });
+
+            std::string filename;
+            for (std::size_t step = 0; step < num_steps; ++step) {
+                auto current = next.get();
+                if (!grid.has_same_grid_as(current.grid))
+                    grid.take_grid_from(std::move(current.grid));
+                if (step + 1 < num_steps)
+                    next = std::async(std::launch::async, [&reader, s=step+1] () {
+                        return ConverterDetail::prefetch_step<CT>(reader, s);
+                    });
+
+                // (a pending prefetch is waited for in the destructor of the future if this throws)
+                ConverterDetail::add_piece_fields(current, writer);
+                filename = writer.write(current.time);
+                call_back(step, filename);
+            }
+            return filename;
+        }
+    });
 }
 
 namespace Traits {
 
 // to distinguish points/cells we use different integer types
 
-template<>
-struct Points<ConverterDetail::ConverterGrid> {
-    static std::ranges::range auto get(const ConverterDetail::ConverterGrid& grid) {
-        return std::views::iota(std::size_t{0}, grid.reader.number_of_points());
+template<typename T>
+struct Points<ConverterDetail::ConverterGrid<T>> {
+    static std::ranges::range auto get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return std::views::iota(std::size_t{0}, grid.number_of_points());
     }
 };
 
-template<>
-struct Cells<ConverterDetail::ConverterGrid> {
-    static std::ranges::range auto get(const ConverterDetail::ConverterGrid& grid) {
-        const auto max = static_cast<std::int64_t>(grid.reader.number_of_cells());
+template<typename T>
+struct Cells<ConverterDetail::ConverterGrid<T>> {
+    static std::ranges::range auto get(const ConverterDetail::ConverterGrid<T>& grid) {
+        const auto max = static_cast<std::int64_t>(grid.number_of_cells());
         if (max < 0)
             throw TypeError("Integer overflow. Too many grid cells.");
         return std::views::iota(std::int64_t{0}, max);
     }
 };
 
-template<>
-struct NumberOfPoints<ConverterDetail::ConverterGrid> {
-    static std::size_t get(const ConverterDetail::ConverterGrid& grid) {
-        return grid.reader.number_of_points();
+template<typename T>
+struct NumberOfPoints<ConverterDetail::ConverterGrid<T>> {
+    static std::size_t get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.number_of_points();
     }
 };
 
-template<>
-struct NumberOfCells<ConverterDetail::ConverterGrid> {
-    static std::size_t get(const ConverterDetail::ConverterGrid& grid) {
-        return grid.reader.number_of_cells();
+template<typename T>
+struct NumberOfCells<ConverterDetail::ConverterGrid<T>> {
+    static std::size_t get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.number_of_cells();
     }
 };
 
-template<>
-struct CellPoints<ConverterDetail::ConverterGrid, std::int64_t> {
-    static std::ranges::range auto get(const ConverterDetail::ConverterGrid& grid, const std::int64_t i) {
-        return grid.cells.at(i).second | std::views::all;
+template<typename T>
+struct CellPoints<ConverterDetail::ConverterGrid<T>, std::int64_t> {
+    static std::ranges::range auto get(const ConverterDetail::ConverterGrid<T>& grid, const std::int64_t i) {
+        return grid.corners(static_cast<std::size_t>(i));
     }
 };
 
-template<>
-struct CellType<ConverterDetail::ConverterGrid, std::int64_t> {
-    static GridFormat::CellType get(const ConverterDetail::ConverterGrid& grid, const std::int64_t i) {
-        return grid.cells.at(i).first;
+template<typename T>
+struct CellType<ConverterDetail::ConverterGrid<T>, std::int64_t> {
+    static GridFormat::CellType get(const ConverterDetail::ConverterGrid<T>& grid, const std::int64_t i) {
+        return grid.types.at(static_cast<std::size_t>(i));
     }
 };
 
-template<>
-struct PointCoordinates<ConverterDetail::ConverterGrid, std::size_t> {
-    static std::array<double, 3> get(const ConverterDetail::ConverterGrid& grid, const std::size_t i) {
-        return grid.points.at(i);
+template<typename T>
+struct PointCoordinates<ConverterDetail::ConverterGrid<T>, std::size_t> {
+    static std::array<T, 3> get(const ConverterDetail::ConverterGrid<T>& grid, const std::size_t i) {
+        const auto coords = grid.coordinates_span().subspan(i*3, 3);
+        return {coords[0], coords[1], coords[2]};
     }
 };
 
-template<>
-struct PointId<ConverterDetail::ConverterGrid, std::size_t> {
-    static std::size_t get(const ConverterDetail::ConverterGrid&, const std::size_t i) {
+template<typename T>
+struct PointId<ConverterDetail::ConverterGrid<T>, std::size_t> {
+    static std::size_t get(const ConverterDetail::ConverterGrid<T>&, const std::size_t i) {
         return i;
     }
 };
 
-template<>
-struct NumberOfCellPoints<ConverterDetail::ConverterGrid, std::int64_t> {
-    static std::size_t get(const ConverterDetail::ConverterGrid& grid, const std::int64_t i) {
-        return grid.cells.at(i).second.size();
+template<typename T>
+struct NumberOfCellPoints<ConverterDetail::ConverterGrid<T>, std::int64_t> {
+    static std::size_t get(const ConverterDetail::ConverterGrid<T>& grid, const std::int64_t i) {
+        return grid.corners(static_cast<std::size_t>(i)).size();
+    }
+};
+
+template<typename T>
+struct Coordinates<ConverterDetail::ConverterGrid<T>> {
+    static std::span<const T> get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.coordinates_span();
+    }
+};
+
+template<typename T>
+struct Connectivity<ConverterDetail::ConverterGrid<T>> {
+    static const std::vector<std::size_t>& get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.connectivity;
+    }
+};
+
+template<typename T>
+struct Offsets<ConverterDetail::ConverterGrid<T>> {
+    static const std::vector<std::size_t>& get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.offsets;
+    }
+};
+
+template<typename T>
+struct CellTypes<ConverterDetail::ConverterGrid<T>> {
+    static const std::vector<GridFormat::CellType>& get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return grid.types;
     }
 };
 
-template<>
-struct Origin<ConverterDetail::ConverterGrid> {
-    static std::array<double, 3> get(const ConverterDetail::ConverterGrid& grid) {
-        return grid.reader.origin();
+template<typename T>
+struct Origin<ConverterDetail::ConverterGrid<T>> {
+    static std::array<T, 3> get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return Ranges::to_array<3, T>(grid.reader.origin());
     }
 };
 
-template<>
-struct Spacing<ConverterDetail::ConverterGrid> {
-    static std::array<double, 3> get(const ConverterDetail::ConverterGrid& grid) {
-        return grid.reader.spacing();
+template<typename T>
+struct Spacing<ConverterDetail::ConverterGrid<T>> {
+    static std::array<T, 3> get(const ConverterDetail::ConverterGrid<T>& grid) {
+        return Ranges::to_array<3, T>(grid.reader.spacing());
     }
 };
 
-template<>
-struct Basis<ConverterDetail::ConverterGrid> {
-    static std::array<std::array<double, 3>, 3> get(const ConverterDetail::ConverterGrid& grid) {
-        std::array<std::array<double, 3>, 3> result;
+template<typename T>
+struct Basis<ConverterDetail::ConverterGrid<T>> {
+    static std::array<std::array<T, 3>, 3> get(const ConverterDetail::ConverterGrid<T>& grid) {
+        std::array<std::array<T, 3>, 3> result;
         for (unsigned int i = 0; i < 3; ++i)
-            result[i] = grid.reader.basis_vector(i);
+            result[i] = Ranges::to_array<3, T>(grid.reader.basis_vector(i));
         return result;
     }
 };
 
-template<>
-struct Extents<ConverterDetail::ConverterGrid> {
-    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid& grid) {
+template<typename T>
+struct Extents<ConverterDetail::ConverterGrid<T>> {
+    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid<T>& grid) {
         return grid.reader.extents();
     }
 };
 
-template<>
-struct Ordinates<ConverterDetail::ConverterGrid> {
-    static std::vector<double> get(const ConverterDetail::ConverterGrid& grid, unsigned int i) {
+template<typename T>
+struct Ordinates<ConverterDetail::ConverterGrid<T>> {
+    static std::vector<double> get(const ConverterDetail::ConverterGrid<T>& grid, unsigned int i) {
         return grid.reader.ordinates(i);
     }
 };
 
-template<typename Entity>
-struct Location<ConverterDetail::ConverterGrid, Entity> {
-    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid& grid, const std::size_t point) {
-        return _get(Ranges::incremented(Extents<ConverterDetail::ConverterGrid>::get(grid), 1), point);
+template<typename T, typename Entity>
+struct Location<ConverterDetail::ConverterGrid<T>, Entity> {
+    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid<T>& grid, const std::size_t point) {
+        return _get(Ranges::incremented(Extents<ConverterDetail::ConverterGrid<T>>::get(grid), 1), point);
     }
 
-    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid& grid, const std::int64_t cell) {
-        return _get(Extents<ConverterDetail::ConverterGrid>::get(grid), cell);
+    static std::array<std::size_t, 3> get(const ConverterDetail::ConverterGrid<T>& grid, const std::int64_t cell) {
+        return _get(Extents<ConverterDetail::ConverterGrid<T>>::get(grid), cell);
     }
 
  private:
     static std::array<std::size_t, 3> _get(std::ranges::range auto extents, std::integral auto index) {
         // avoid zero extents
-        std::ranges::for_each(extents, [] <std::integral T> (T& e) { e = std::max(e, T{1}); });
+        std::ranges::for_each(extents, [] <std::integral I> (I& e) { e = std::max(e, I{1}); });
         const auto accumulate_until = [&] (int dim) {
             auto range = extents | std::views::take(dim);
             return std::accumulate(
@@ -9,6 +9,7 @@
 #define GRIDFORMAT_GRID_FILTERED_HPP_
 
 #include <type_traits>
+#include <unordered_set>
 #include <concepts>
 #include <ranges>
 
@@ -18,6 +19,7 @@
 #include <gridformat/grid/concepts.hpp>
 #include <gridformat/grid/type_traits.hpp>
 #include <gridformat/grid/traits.hpp>
+#include <gridformat/grid/grid.hpp>
 
 namespace GridFormat {
 
@@ -26,7 +28,7 @@ namespace GridFormat {
  * \brief Wrapper around a grid that exposes only those cells fulfilling a given predicate.
  * \note The wrapped grid fulfills the UnstructuredGrid concept and thus requires the given grid to do so as well.
  * \note All points of the original grid are exposed, i.e. they are not filtered to contain only those connected to
- *       the filtered cells.
+ *       the filtered cells. Use CompactFilteredGrid if only the points of the filtered cells should be exposed.
  */
 template<Concepts::UnstructuredGrid G, typename Predicate>
     requires(
@@ -66,6 +68,46 @@ template<typename G, typename P> requires(Concepts::UnstructuredGrid<std::remove
 FilteredGrid(G&&, P&&) -> FilteredGrid<std::remove_cvref_t<G>, P>;
 
 
+/*!
+ * \ingroup Grid
+ * \brief Wrapper around a grid that exposes only those cells fulfilling a given predicate,
+ *        and only those points that are connected to these cells.
+ * \details Upon construction, the ids of all points used by the filtered cells are collected.
+ *          Since writers number the points in the order in which they are visited, the connectivity
+ *          of the filtered cells is written with respect to this compact set of points, and point fields
+ *          are only evaluated on these points.
+ */
+template<Concepts::UnstructuredGrid G, typename Predicate>
+class CompactFilteredGrid : public FilteredGrid<G, Predicate> {
+    using ParentType = FilteredGrid<G, Predicate>;
+
+ public:
+    template<typename P> requires(std::convertible_to<P, LVReferenceOrValue<Predicate>>)
+    explicit CompactFilteredGrid(const G& grid, P&& p)
+    : ParentType(grid, std::forward<P>(p)) {
+        std::ranges::for_each(std::views::filter(Traits::Cells<G>::get(grid), this->predicate()), [&] (const auto& c) {
+            std::ranges::for_each(GridFormat::points(grid, c), [&] (const auto& point) {
+                _point_ids.insert(GridFormat::id(grid, point));
+            });
+        });
+    }
+
+    std::size_t number_of_points() const {
+        return _point_ids.size();
+    }
+
+    bool is_used(const Point<G>& p) const {
+        return _point_ids.contains(GridFormat::id(this->unwrap(), p));
+    }
+
+ private:
+    std::unordered_set<std::size_t> _point_ids;
+};
+
+template<typename G, typename P> requires(Concepts::UnstructuredGrid<std::remove_cvref_t<G>>, std::is_lvalue_reference_v<G>)
+CompactFilteredGrid(G&&, P&&) -> CompactFilteredGrid<std::remove_cvref_t<G>, P>;
+
+
 #ifndef DOXYGEN
 namespace Traits {
 
@@ -118,6 +160,40 @@ struct NumberOfCells<FilteredGrid<G, P>> {
     }
 };
 
+template<Concepts::UnstructuredGrid G, typename P>
+struct Points<CompactFilteredGrid<G, P>> {
+    static std::ranges::range auto get(const CompactFilteredGrid<G, P>& grid) {
+        return std::views::filter(Points<G>::get(grid.unwrap()), [_grid=&grid] (const Point<G>& p) {
+            return _grid->is_used(p);
+        });
+    }
+};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct NumberOfPoints<CompactFilteredGrid<G, P>> {
+    static auto get(const CompactFilteredGrid<G, P>& grid) {
+        return grid.number_of_points();
+    }
+};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct Cells<CompactFilteredGrid<G, P>> : public Cells<FilteredGrid<G, P>> {};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct PointCoordinates<CompactFilteredGrid<G, P>, Point<G>> : public PointCoordinates<FilteredGrid<G, P>, Point<G>> {};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct CellPoints<CompactFilteredGrid<G, P>, Cell<G>> : public CellPoints<FilteredGrid<G, P>, Cell<G>> {};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct PointId<CompactFilteredGrid<G, P>, Point<G>> : public PointId<FilteredGrid<G, P>, Point<G>> {};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct CellType<CompactFilteredGrid<G, P>, Cell<G>> : public CellType<FilteredGrid<G, P>, Cell<G>> {};
+
+template<Concepts::UnstructuredGrid G, typename P>
+struct NumberOfCells<CompactFilteredGrid<G, P>> : public NumberOfCells<FilteredGrid<G, P>> {};
+
 }  // namespace Traits
 #endif  // DOXYGEN
 
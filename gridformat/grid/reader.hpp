@@ -17,8 +17,12 @@
 #include <sstream>
 #include <string>
 #include <span>
+#include <algorithm>
 
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/lazy_field.hpp>
+#include <gridformat/common/md_layout.hpp>
+#include <gridformat/common/serialization.hpp>
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/concepts.hpp>
@@ -44,6 +48,105 @@ concept GridFactory = requires(T& t) {
 
 namespace GridFormat {
 
+#ifndef DOXYGEN
+namespace GridReaderDetail {
+
+    // Return a field that contains the entries of the given field at the given indices
+    inline FieldPtr select_entries(FieldPtr field, std::vector<std::size_t> indices) {
+        const auto layout = field->layout();
+        std::vector<std::size_t> dimensions(layout.dimension());
+        layout.export_to(dimensions);
+        dimensions.at(0) = indices.size();
+        const auto precision = field->precision();
+        return make_field_ptr(LazyField{
+            std::move(field),
+            MDLayout{std::move(dimensions)},
+            precision,
+            [_indices=std::move(indices)] (const FieldPtr& f) {
+                const auto f_layout = f->layout();
+                const auto values = f->serialized();
+                const auto num_entries = f_layout.extent(0);
+                const auto entry_size = num_entries > 0 ? values.size()/num_entries : 0;
+                Serialization result{_indices.size()*entry_size};
+                for (std::size_t i = 0; i < _indices.size(); ++i) {
+                    if (_indices[i] >= num_entries)
+                        throw ValueError(
+                            "Index " + std::to_string(_indices[i]) + " exceeds the number of entries ("
+                            + std::to_string(num_entries) + ")"
+                        );
+                    std::copy_n(
+                        values.as_span().begin() + _indices[i]*entry_size,
+                        entry_size,
+                        result.as_span().begin() + i*entry_size
+                    );
+                }
+                return result;
+            }
+        });
+    }
+
+    // Per-direction offsets and numbers of the entities of a structured piece within a region
+    struct StructuredSelection {
+        std::array<std::size_t, 3> offset;
+        std::array<std::size_t, 3> count;
+        std::array<std::size_t, 3> piece_count;
+
+        // contiguous runs {first, count} of the selected flat indices (x running fastest)
+        std::vector<std::array<std::size_t, 2>> runs() const {
+            std::vector<std::array<std::size_t, 2>> result;
+            if (count[0] == 0)
+                return result;
+            for (std::size_t k = 0; k < count[2]; ++k)
+                for (std::size_t j = 0; j < count[1]; ++j) {
+                    const auto first = offset[0] + piece_count[0]*(offset[1] + j + piece_count[1]*(offset[2] + k));
+                    if (!result.empty() && result.back()[0] + result.back()[1] == first)
+                        result.back()[1] += count[0];
+                    else
+                        result.push_back({first, count[0]});
+                }
+            return result;
+        }
+
+        std::vector<std::size_t> indices() const {
+            std::vector<std::size_t> result;
+            for (const auto& [first, n] : runs())
+                for (std::size_t i = 0; i < n; ++i)
+                    result.push_back(first + i);
+            return result;
+        }
+    };
+
+    // Select the cells or points of a structured piece that lie within the given region, where the cells
+    // between the lower-left and upper-right corners of the region are selected, together with their points
+    template<typename Location>
+    StructuredSelection select_structured(const Location& piece, const Location& region, bool points) {
+        StructuredSelection result;
+        for (unsigned int dir = 0; dir < 3; ++dir) {
+            const auto lower = region.lower_left[dir];
+            const auto upper = region.upper_right[dir];
+            if (lower > upper || lower < piece.lower_left[dir] || upper > piece.upper_right[dir])
+                throw ValueError(
+                    "Given region [" + std::to_string(lower) + ", " + std::to_string(upper) + "] "
+                    + "exceeds the piece [" + std::to_string(piece.lower_left[dir]) + ", "
+                    + std::to_string(piece.upper_right[dir]) + "] in direction " + std::to_string(dir)
+                );
+
+            const auto piece_extent = piece.upper_right[dir] - piece.lower_left[dir];
+            result.offset[dir] = lower - piece.lower_left[dir];
+            if (points) {
+                result.count[dir] = upper - lower + 1;
+                result.piece_count[dir] = piece_extent + 1;
+            } else {  // directions without extent are treated as a single layer of cells
+                result.count[dir] = piece_extent == 0 ? 1 : upper - lower;
+                result.piece_count[dir] = std::max(piece_extent, std::size_t{1});
+            }
+        }
+        return result;
+    }
+
+}  // namespace GridReaderDetail
+#endif  // DOXYGEN
+
 //! \addtogroup Grid
 //! \{
 
@@ -217,11 +320,53 @@ class GridReader {
         return _point_field(name);
     }
 
+    /*!
+     * \brief Return the values of the cell field with the given name within the given region
+     *        (only available for structured grid formats).
+     * \details The region is given in the index space of location() and contains the cells between its
+     *          lower-left and upper-right corners. Readers of formats that allow for partial reads only read
+     *          the data overlapping the region, while by default the entire field is read and sliced.
+     */
+    FieldPtr cell_field(std::string_view name, const PieceLocation& region) const {
+        return _cell_field_in_region(name, region);
+    }
+
+    /*!
+     * \brief Return the values of the point field with the given name within the given region
+     *        (only available for structured grid formats).
+     * \details The region contains the points of the cells between its lower-left and upper-right
+     *          corners (including those on the boundary). See also cell_field(name, region).
+     */
+    FieldPtr point_field(std::string_view name, const PieceLocation& region) const {
+        return _point_field_in_region(name, region);
+    }
+
     //! Return the meta data field with the given name
     FieldPtr meta_data_field(std::string_view name) const {
         return _meta_data_field(name);
     }
 
+    /*!
+     * \brief Return the values of the cell field with the given name at the given cells for all steps
+     *        (only available for sequence formats).
+     * \details The i-th returned field contains the values at step i, with one entry per given cell index.
+     *          Readers of formats that allow for partial reads only read the requested entries, and readers
+     *          of file series may read the steps concurrently. By default, all steps are visited via set_step().
+     * \note The current step of the reader may have changed after this call.
+     */
+    std::vector<FieldPtr> cell_field_history(std::string_view name, std::span<const std::size_t> cell_indices) {
+        return _cell_field_history(name, cell_indices, _field_names);
+    }
+
+    /*!
+     * \brief Return the values of the point field with the given name at the given points for all steps
+     *        (only available for sequence formats).
+     * \details See cell_field_history().
+     */
+    std::vector<FieldPtr> point_field_history(std::string_view name, std::span<const std::size_t> point_indices) {
+        return _point_field_history(name, point_indices, _field_names);
+    }
+
     //! Return a range over the names of all read cell fields
     friend std::ranges::range auto cell_field_names(const GridReader& reader) {
         return reader._field_names.cell_fields;
@@ -313,6 +458,20 @@ class GridReader {
         throw NotImplemented("Extents/Location are only available with structured grid formats");
     }
 
+    virtual FieldPtr _cell_field_in_region(std::string_view name, const PieceLocation& region) const {
+        return GridReaderDetail::select_entries(
+            _cell_field(name),
+            GridReaderDetail::select_structured(_location(), region, false).indices()
+        );
+    }
+
+    virtual FieldPtr _point_field_in_region(std::string_view name, const PieceLocation& region) const {
+        return GridReaderDetail::select_entries(
+            _point_field(name),
+            GridReaderDetail::select_structured(_location(), region, true).indices()
+        );
+    }
+
     virtual std::vector<double> _ordinates(unsigned int) const {
         throw NotImplemented("Ordinates are only available with rectilinear grid formats.");
     }
@@ -344,6 +503,31 @@ class GridReader {
     virtual void _set_step(std::size_t, FieldNames&) {
         throw NotImplemented("The format read by '" + _name() + "' is not a sequence");
     }
+
+    virtual std::vector<FieldPtr> _cell_field_history(std::string_view name,
+                                                      std::span<const std::size_t> indices,
+                                                      FieldNames& names) {
+        return _field_history_over_steps(indices, names, [&] () { return _cell_field(name); });
+    }
+
+    virtual std::vector<FieldPtr> _point_field_history(std::string_view name,
+                                                       std::span<const std::size_t> indices,
+                                                       FieldNames& names) {
+        return _field_history_over_steps(indices, names, [&] () { return _point_field(name); });
+    }
+
+    template<typename FieldGetter>
+    std::vector<FieldPtr> _field_history_over_steps(std::span<const std::size_t> indices,
+                                                    FieldNames& names,
+                                                    const FieldGetter& get_field) {
+        const std::vector<std::size_t> entity_indices(indices.begin(), indices.end());
+        std::vector<FieldPtr> result;
+        for (std::size_t step = 0; step < _number_of_steps(); ++step) {
+            _set_step(step, names);
+            result.push_back(GridReaderDetail::select_entries(get_field(), entity_indices));
+        }
+        return result;
+    }
 };
 
 //! \} group Grid
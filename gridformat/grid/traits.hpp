@@ -52,6 +52,30 @@ struct PointId;
 template<typename Grid, typename Cell>
 struct NumberOfCellPoints;
 
+/*!
+ * \brief Exposes the coordinates of all points as a contiguous range via a static function `get(const Grid&)` (optional trait)
+ * \details The coordinates are expected to be stored point by point, in the order of the range exposed by `Points`,
+ *          with as many values per point as are returned by `PointCoordinates`.
+ */
+template<typename Grid>
+struct Coordinates;
+
+/*!
+ * \brief Exposes the corner indices of all cells as a contiguous range via a static function `get(const Grid&)` (optional trait)
+ * \details The indices are expected to be stored cell by cell, in the order of the range exposed by `Cells`, and they
+ *          refer to the positions of the corners within the range exposed by `Points`.
+ */
+template<typename Grid>
+struct Connectivity;
+
+//! Exposes, for each cell, the offset past its last corner in the `Connectivity` range via a static function `get(const Grid&)` (optional trait)
+template<typename Grid>
+struct Offsets;
+
+//! Exposes the types of all cells as a contiguous range via a static function `get(const Grid&)` (optional trait)
+template<typename Grid>
+struct CellTypes;
+
 //! \} group UnstructuredGrid
 
 //! \addtogroup StructuredGrid
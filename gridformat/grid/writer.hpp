@@ -13,6 +13,7 @@
 #include <ranges>
 #include <fstream>
 #include <ostream>
+#include <sstream>
 #include <concepts>
 #include <type_traits>
 
@@ -24,6 +25,7 @@
 #include <gridformat/common/range_field.hpp>
 #include <gridformat/common/scalar_field.hpp>
 #include <gridformat/common/logging.hpp>
+#include <gridformat/common/output_sink.hpp>
 
 #include <gridformat/grid/grid.hpp>
 #include <gridformat/grid/_detail.hpp>
@@ -324,16 +326,62 @@ class GridWriter : public GridWriterBase<Grid> {
         _write(s);
     }
 
+    /*!
+     * \brief Write the grid and data into the given sink instead of the file system.
+     * \param filename The name (without extension) that would be used for the file.
+     * \param sink The sink that receives each file the writer would create as a complete buffer.
+     * \return The name of the (main) file as passed to the sink.
+     */
+    std::string write(const std::string& filename, OutputSink& sink) const {
+        SinkGuard guard{_sink, sink};
+        return write(filename);
+    }
+
     const std::string& extension() const {
         return _extension;
     }
 
+ protected:
+    //! Return true if the output is currently redirected into a sink
+    bool _writes_into_sink() const {
+        return _sink != nullptr;
+    }
+
+    //! Create the file with the given name, or pass it to the sink if one is set
+    template<std::invocable<std::ostream&> Action>
+    void _write_output(const std::string& filename_with_ext, const Action& action) const {
+        if (_sink) {
+            std::ostringstream s;
+            action(s);
+            _sink->receive(filename_with_ext, std::move(s).str());
+        } else {
+            std::ofstream result_file(filename_with_ext, std::ios::out);
+            action(result_file);
+        }
+    }
+
+    //! Write the output of a nested writer (e.g. for pieces) into the same destination as this writer
+    template<typename Writer>
+    std::string _write_nested(const Writer& writer, const std::string& filename) const {
+        if (_sink)
+            return writer.write(filename, *_sink);
+        return writer.write(filename);
+    }
+
  private:
+    class SinkGuard {
+     public:
+        SinkGuard(OutputSink*& target, OutputSink& sink) : _target{target} { _target = &sink; }
+        ~SinkGuard() { _target = nullptr; }
+     private:
+        OutputSink*& _target;
+    };
+
     std::string _extension;
+    mutable OutputSink* _sink = nullptr;
 
     virtual void _write(const std::string& filename_with_ext) const {
-        std::ofstream result_file(filename_with_ext, std::ios::out);
-        _write(result_file);
+        _write_output(filename_with_ext, [&] (std::ostream& s) { _write(s); });
     }
 
     virtual void _write(std::ostream&) const = 0;
@@ -14,8 +14,11 @@
 #ifndef GRIDFORMAT_GRIDFORMAT_HPP_
 #define GRIDFORMAT_GRIDFORMAT_HPP_
 
+#include <span>
 #include <memory>
+#include <fstream>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 #include <gridformat/reader.hpp>
@@ -488,6 +491,30 @@ namespace APIDetail {
 
         void _open(const std::string& filename, typename GridReader::FieldNames& names) override {
             _close();
+            if (const auto type = VTK::XML::probe_file_type(filename); type.has_value())
+                _open_variant(filename, !VTK::XML::is_parallel_file_type(type.value()));
+            else
+                _open_any_variant(filename);
+            ReaderDetail::copy_field_names(_access(), names);
+        }
+
+        // open the variant deduced from the file header directly
+        void _open_variant(const std::string& filename, bool sequential) {
+            try {
+                if (sequential)
+                    _seq_reader.open(filename);
+                else
+                    _par_reader.open(filename);
+                _use_sequential = sequential;
+            } catch (...) {
+                _use_sequential.reset();
+                sequential ? _seq_reader.close() : _par_reader.close();
+                throw;
+            }
+        }
+
+        // fallback for files whose type could not be deduced: try both variants
+        void _open_any_variant(const std::string& filename) {
             std::string seq_error;
             try {
                 _seq_reader.open(filename);
@@ -509,8 +536,6 @@ namespace APIDetail {
                     );
                 }
             }
-
-            ReaderDetail::copy_field_names(_access(), names);
         }
 
         void _close() override {
@@ -525,6 +550,14 @@ namespace APIDetail {
         FieldPtr _cell_field(std::string_view n) const override { return _access().cell_field(n); }
         FieldPtr _point_field(std::string_view n) const override { return _access().point_field(n); }
         FieldPtr _meta_data_field(std::string_view n) const override { return _access().meta_data_field(n); }
+        FieldPtr _cell_field_in_region(std::string_view n,
+                                       const typename GridReader::PieceLocation& r) const override {
+            return _access().cell_field(n, r);
+        }
+        FieldPtr _point_field_in_region(std::string_view n,
+                                        const typename GridReader::PieceLocation& r) const override {
+            return _access().point_field(n, r);
+        }
 
         FieldPtr _points() const override { return _access().points(); }
         void _visit_cells(const typename GridReader::CellVisitor& v) const override { _access().visit_cells(v); }
@@ -544,6 +577,24 @@ namespace APIDetail {
             ReaderDetail::copy_field_names(_access(), names);
         }
 
+        std::vector<FieldPtr> _cell_field_history(std::string_view n,
+                                                  std::span<const std::size_t> indices,
+                                                  typename GridReader::FieldNames& names) override {
+            auto result = _access().cell_field_history(n, indices);
+            names.clear();
+            ReaderDetail::copy_field_names(_access(), names);
+            return result;
+        }
+
+        std::vector<FieldPtr> _point_field_history(std::string_view n,
+                                                   std::span<const std::size_t> indices,
+                                                   typename GridReader::FieldNames& names) override {
+            auto result = _access().point_field_history(n, indices);
+            names.clear();
+            ReaderDetail::copy_field_names(_access(), names);
+            return result;
+        }
+
         bool _is_set() const { return _use_sequential.has_value(); }
         void _throw_if_not_set() const {
             if (!_is_set())
@@ -889,7 +940,7 @@ struct ReaderFactory<FileFormat::PVDClosure>
 template<> struct WriterFactory<FileFormat::Any> {
  private:
     template<typename G>
-    static constexpr bool is_converter_grid = std::same_as<G, ConverterDetail::ConverterGrid>;
+    static constexpr bool is_converter_grid = ConverterDetail::is_converter_grid<G>;
 
     template<typename F, typename... Args>
     static auto _make(F&& format, Args&&... args) {
@@ -964,6 +1015,37 @@ namespace APIDetail {
             return std::make_unique<Reader>(c);
     }
 
+    // Detect the HDF5 format signature at the beginning of the file
+    bool has_hdf_signature(const std::string& filename) {
+        static constexpr std::string_view signature{"\x89HDF\r\n\x1a\n", 8};
+        std::ifstream file{filename, std::ios::binary};
+        std::string chars(signature.size(), '\0');
+        file.read(chars.data(), static_cast<std::streamsize>(signature.size()));
+        return file && chars == signature;
+    }
+
+    // Select the reader from the file header for files without a known extension
+    template<Concepts::Communicator C>
+    std::unique_ptr<GridReader> make_reader_from_header(const std::string& filename, const C& c) {
+        if (const auto type = VTK::XML::probe_file_type(filename); type.has_value()) {
+            if (type == "UnstructuredGrid") return make_reader<VTUReader>(c);
+            else if (type == "PolyData") return make_reader<VTPReader>(c);
+            else if (type == "ImageData") return make_reader<VTIReader>(c);
+            else if (type == "RectilinearGrid") return make_reader<VTRReader>(c);
+            else if (type == "StructuredGrid") return make_reader<VTSReader>(c);
+            else if (type == "PUnstructuredGrid") return make_reader<PVTUReader>(c);
+            else if (type == "PPolyData") return make_reader<PVTPReader>(c);
+            else if (type == "PImageData") return make_reader<PVTIReader>(c);
+            else if (type == "PRectilinearGrid") return make_reader<PVTRReader>(c);
+            else if (type == "PStructuredGrid") return make_reader<PVTSReader>(c);
+            else if (type == "Collection") return make_reader<PVDReader<C>>(c);
+        }
+#if GRIDFORMAT_HAVE_HIGH_FIVE
+        if (has_hdf_signature(filename)) return make_reader<VTKHDFReader<C>>(c);
+#endif
+        return nullptr;
+    }
+
     template<Concepts::Communicator C>
     std::unique_ptr<GridReader> make_reader_for(const std::string& filename, const C& c) {
         if (filename.ends_with(".vtu")) return make_reader<VTUReader>(c);
@@ -980,6 +1062,7 @@ namespace APIDetail {
 #if GRIDFORMAT_HAVE_HIGH_FIVE
         else if (has_hdf_file_extension(filename)) return make_reader<VTKHDFReader<C>>(c);
 #endif
+        else if (auto reader = make_reader_from_header(filename, c)) return reader;
         throw IOError("Could not deduce an available file format for '" + filename + "'");
     }
 
@@ -1026,7 +1109,7 @@ std::string convert(const std::string& in,
     using WriterDetail::has_sequential_factory;
     using WriterDetail::has_parallel_time_series_factory;
     using WriterDetail::has_sequential_time_series_factory;
-    using CG = ConverterDetail::ConverterGrid;
+    using CG = ConverterDetail::ConverterGrid<>;
 
     static constexpr bool is_single_file_out_format = [&] () {
         if constexpr (use_communicator) return has_parallel_factory<OutFormat, CG, Communicator>;
@@ -1065,6 +1148,20 @@ std::string convert(const std::string& in,
             std::cout << "Wrote step " << step_idx << " to '" << filename << "'" << std::endl;
     };
 
+    // sequences are read ahead on a separate thread, unless this requires concurrent communication or
+    // HDF5 access (HDF5 libraries are not necessarily built thread-safe)
+    const bool use_pipelining = [&] () {
+        if constexpr (use_communicator)
+            if (Parallel::size(communicator) > 1)
+                return false;
+        return !reader.name().starts_with("VTKHDF");
+    } ();
+    const auto convert_sequence = [&] (const auto& factory) {
+        if (use_pipelining)
+            return convert_pipelined(reader, factory, step_call_back);
+        return convert(reader, factory, step_call_back);
+    };
+
     const auto invoke_factory = [&] <typename Fmt, typename... T> (const Fmt& fmt, const auto& grid, T&&... args) {
         if constexpr (use_communicator)
             return WriterFactory<Fmt>::make(fmt, grid, communicator, std::forward<T>(args)...);
@@ -1074,9 +1171,9 @@ std::string convert(const std::string& in,
 
     if constexpr (is_single_file_out_format) {
         if (reader.is_sequence())
-            return convert(reader, [&] (const auto& grid) {
+            return convert_sequence([&] (const auto& grid) {
                 return invoke_factory(FileFormat::TimeSeriesClosure{}(opts.out_format), grid, out);
-            }, step_call_back);
+            });
 
         const auto filename = convert(reader, out, [&] (const auto& grid) {
             return invoke_factory(opts.out_format, grid);
@@ -1085,9 +1182,9 @@ std::string convert(const std::string& in,
             std::cout << "Wrote '" << filename << "'" << std::endl;
         return filename;
     } else if constexpr (is_time_series_out_format) {
-        return convert(reader, [&] (const auto& grid) {
+        return convert_sequence([&] (const auto& grid) {
             return invoke_factory(opts.out_format, grid, out);
-        }, step_call_back);
+        });
     } else {
         static_assert(
             APIDetail::always_false<OutFormat>,
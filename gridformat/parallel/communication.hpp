@@ -8,6 +8,9 @@
 #ifndef GRIDFORMAT_PARALLEL_COMMUNICATION_HPP_
 #define GRIDFORMAT_PARALLEL_COMMUNICATION_HPP_
 
+#include <vector>
+#include <ranges>
+
 #include <gridformat/parallel/traits.hpp>
 #include <gridformat/parallel/concepts.hpp>
 
@@ -64,12 +67,30 @@ inline auto gather(const C& comm, const T& values, int root = 0) {
     return ParallelTraits::Gather<C>::get(comm, values, root);
 }
 
+//! Gather values from all processes on all processes
+template<Concepts::AllGatherCommunicator C, typename T>
+inline auto all_gather(const C& comm, const T& values) {
+    return ParallelTraits::AllGather<C>::get(comm, values);
+}
+
 //! Scatter values from the root to all other processes
 template<Concepts::SumCommunicator C, typename T>
 inline auto scatter(const C& comm, const T& values, int root = 0) {
     return ParallelTraits::Scatter<C>::get(comm, values, root);
 }
 
+//! Send values to the process with the given rank
+template<Concepts::PointToPointCommunicator C, std::ranges::contiguous_range R>
+inline int send(const C& comm, const R& values, int destination_rank, int tag = 0) {
+    return ParallelTraits::Send<C>::get(comm, values, destination_rank, tag);
+}
+
+//! Receive values of type T sent from the process with the given rank
+template<typename T, Concepts::PointToPointCommunicator C>
+inline std::vector<T> receive(const C& comm, int source_rank, int tag = 0) {
+    return ParallelTraits::Receive<C>::template get<T>(comm, source_rank, tag);
+}
+
 //! \} group Parallel
 
 }  // namespace GridFormat::Parallel
@@ -71,12 +71,30 @@ concept GatherCommunicator = is_complete<ParallelTraits::Gather<T>> && requires(
     { ParallelTraits::Gather<T>::get(t, std::array<double, 2>{}) } -> RangeOf<double>;
 };
 
+template<typename T>
+concept AllGatherCommunicator = is_complete<ParallelTraits::AllGather<T>> && requires(const T& t) {
+    { ParallelTraits::AllGather<T>::get(t, int{}) } -> RangeOf<int>;
+    { ParallelTraits::AllGather<T>::get(t, double{}) } -> RangeOf<double>;
+    { ParallelTraits::AllGather<T>::get(t, std::array<int, 2>{}) } -> RangeOf<int>;
+    { ParallelTraits::AllGather<T>::get(t, std::array<double, 2>{}) } -> RangeOf<double>;
+};
+
 template<typename T>
 concept ScatterCommunicator = is_complete<ParallelTraits::Scatter<T>> && requires(const T& t) {
     { ParallelTraits::Scatter<T>::get(t, std::array<int, 2>{}) } -> RangeOf<int>;
     { ParallelTraits::Scatter<T>::get(t, std::array<double, 2>{}) } -> RangeOf<double>;
 };
 
+template<typename T>
+concept PointToPointCommunicator
+    = is_complete<ParallelTraits::Send<T>>
+    and is_complete<ParallelTraits::Receive<T>>
+    and requires(const T& t) {
+        { ParallelTraits::Send<T>::get(t, std::array<int, 2>{}, int{}, int{}) } -> std::convertible_to<int>;
+        { ParallelTraits::Receive<T>::template get<int>(t, int{}, int{}) } -> RangeOf<int>;
+        { ParallelTraits::Receive<T>::template get<double>(t, int{}, int{}) } -> RangeOf<double>;
+    };
+
 //! \} group Concepts
 
 }  // namespace GridFormat::Concepts
@@ -9,7 +9,9 @@
 #define GRIDFORMAT_PARALLEL_TRAITS_HPP_
 
 #include <array>
+#include <limits>
 #include <ranges>
+#include <cstddef>
 #include <vector>
 #include <type_traits>
 #include <algorithm>
@@ -57,11 +59,23 @@ struct BroadCast;
 template<typename Communicator>
 struct Gather;
 
+//! Metafunction to gather values from all processes on all processes via a static function `std::vector<T> get(const Communicator&, const T& values)`
+template<typename Communicator>
+struct AllGather;
+
 //! Metafunction to scatter values to all processes via a static function `std::vector<T> get(const Communicator&, const T& values, int root_rank = 0)`
 //! Only the root process will receive the result
 template<typename Communicator>
 struct Scatter;
 
+//! Metafunction to send values to another process via a static function `int get(const Communicator&, const R& values, int destination_rank, int tag = 0)`
+template<typename Communicator>
+struct Send;
+
+//! Metafunction to receive values sent from another process via a static function `std::vector<T> get<T>(const Communicator&, int source_rank, int tag = 0)`
+template<typename Communicator>
+struct Receive;
+
 //! \} group Parallel
 
 }  // namespace GridFormat::ParallelTraits
@@ -139,6 +153,14 @@ struct Gather<NullCommunicator> {
     }
 };
 
+template<>
+struct AllGather<NullCommunicator> {
+    template<typename T>
+    static constexpr auto get(const NullCommunicator& comm, const T& values) {
+        return Gather<NullCommunicator>::get(comm, values);
+    }
+};
+
 template<>
 struct Scatter<NullCommunicator> {
  public:
@@ -204,6 +226,8 @@ decltype(auto) get_data_type() {
         return MPI_DOUBLE;
     else if constexpr (std::is_same_v<T, long double>)
         return MPI_LONG_DOUBLE;
+    else if constexpr (std::is_same_v<T, std::byte>)
+        return MPI_BYTE;
     else
         throw TypeError("Cannot deduce mpi type from given type");
 }
@@ -391,6 +415,42 @@ struct Gather<MPI_Comm> {
     }
 };
 
+template<>
+struct AllGather<MPI_Comm> {
+    template<Concepts::Scalar T>
+    static auto get(MPI_Comm comm, const T& value) {
+        static constexpr int num_values = 1;
+        std::vector<T> result(Size<MPI_Comm>::get(comm), T{0});
+        MPI_Allgather(
+            &value,
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            result.data(),
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            comm
+        );
+        return result;
+    }
+
+    template<Concepts::StaticallySizedMDRange<1> R> requires(std::ranges::contiguous_range<R>)
+    static auto get(MPI_Comm comm, const R& values) {
+        using T = std::ranges::range_value_t<R>;
+        static constexpr int num_values = static_size<R>;
+        std::vector<T> result(Size<MPI_Comm>::get(comm)*num_values, T{0});
+        MPI_Allgather(
+            std::ranges::cdata(values),
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            result.data(),
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            comm
+        );
+        return result;
+    }
+};
+
 template<>
 struct Scatter<MPI_Comm> {
     template<std::ranges::contiguous_range R> requires(
@@ -441,6 +501,48 @@ struct Scatter<MPI_Comm> {
     }
 };
 
+template<>
+struct Send<MPI_Comm> {
+    template<std::ranges::contiguous_range R> requires(std::ranges::sized_range<R>)
+    static int get(MPI_Comm comm, const R& values, int destination_rank, int tag = 0) {
+        using T = std::ranges::range_value_t<R>;
+        if (std::ranges::size(values) > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+            throw SizeError("Number of values to be sent exceeds the maximum message size");
+        return MPI_Send(
+            std::ranges::cdata(values),
+            static_cast<int>(std::ranges::size(values)),
+            MPIDetail::get_data_type<T>(),
+            destination_rank,
+            tag,
+            comm
+        );
+    }
+};
+
+template<>
+struct Receive<MPI_Comm> {
+    template<typename T>
+    static std::vector<T> get(MPI_Comm comm, int source_rank, int tag = 0) {
+        MPI_Status status;
+        MPI_Probe(source_rank, tag, comm, &status);
+
+        int num_values;
+        MPI_Get_count(&status, MPIDetail::get_data_type<T>(), &num_values);
+
+        std::vector<T> result(num_values);
+        MPI_Recv(
+            result.data(),
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            source_rank,
+            tag,
+            comm,
+            MPI_STATUS_IGNORE
+        );
+        return result;
+    }
+};
+
 }  // namespace GridFormat::ParallelTraits
 
 #endif  // GRIDFORMAT_HAVE_MPI
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <iterator>
 #include <string>
+#include <span>
 
 #include <gridformat/common/type_traits.hpp>
 #include <gridformat/parallel/concepts.hpp>
@@ -182,6 +183,16 @@ class Reader : public GridReader {
         return _access_reader().point_field(name);
     }
 
+    FieldPtr _cell_field_in_region(std::string_view name,
+                                   const typename GridReader::PieceLocation& region) const override {
+        return _access_reader().cell_field(name, region);
+    }
+
+    FieldPtr _point_field_in_region(std::string_view name,
+                                    const typename GridReader::PieceLocation& region) const override {
+        return _access_reader().point_field(name, region);
+    }
+
     FieldPtr _meta_data_field(std::string_view name) const override {
         return _access_reader().meta_data_field(name);
     }
@@ -232,6 +243,24 @@ class Reader : public GridReader {
         ReaderDetail::copy_field_names(_access_reader(), field_names);
     }
 
+    std::vector<FieldPtr> _cell_field_history(std::string_view name,
+                                              std::span<const std::size_t> indices,
+                                              typename GridReader::FieldNames& field_names) override {
+        auto result = _access_reader().cell_field_history(name, indices);
+        field_names.clear();
+        ReaderDetail::copy_field_names(_access_reader(), field_names);
+        return result;
+    }
+
+    std::vector<FieldPtr> _point_field_history(std::string_view name,
+                                               std::span<const std::size_t> indices,
+                                               typename GridReader::FieldNames& field_names) override {
+        auto result = _access_reader().point_field_history(name, indices);
+        field_names.clear();
+        ReaderDetail::copy_field_names(_access_reader(), field_names);
+        return result;
+    }
+
     const GridReader& _access_reader() const {
         _check_reader_access();
         return *_reader;
@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_TRAITS_DOLFINX_HPP_
 #define GRIDFORMAT_TRAITS_DOLFINX_HPP_
 
+#include <span>
 #include <array>
 #include <ranges>
 #include <cstdint>
@@ -154,6 +155,13 @@ struct NumberOfCellPoints<dolfinx::mesh::Mesh, DolfinX::Cell> {
     }
 };
 
+template<>
+struct Coordinates<dolfinx::mesh::Mesh> {
+    static std::ranges::contiguous_range auto get(const dolfinx::mesh::Mesh& mesh) {
+        return mesh.geometry().x();
+    }
+};
+
 }  // namespace Traits
 
 namespace DolfinX {
@@ -208,6 +216,15 @@ class LagrangePolynomialGrid {
         return _node_ids[p.index];
     }
 
+    std::span<const double> coordinates() const {
+        assert(_node_coords_shape[1] == 3);
+        return _node_coords;
+    }
+
+    std::span<const std::int64_t> connectivity() const {
+        return _cells;
+    }
+
     auto position(const Point& p) const {
         assert(_node_coords_shape[1] == 3);
         return std::array{
@@ -452,6 +469,20 @@ struct NumberOfCellPoints<DolfinX::LagrangePolynomialGrid, DolfinX::Cell> {
     }
 };
 
+template<>
+struct Coordinates<DolfinX::LagrangePolynomialGrid> {
+    static std::ranges::contiguous_range auto get(const DolfinX::LagrangePolynomialGrid& mesh) {
+        return mesh.coordinates();
+    }
+};
+
+template<>
+struct Connectivity<DolfinX::LagrangePolynomialGrid> {
+    static std::ranges::contiguous_range auto get(const DolfinX::LagrangePolynomialGrid& mesh) {
+        return mesh.connectivity();
+    }
+};
+
 }  // namespace Traits
 }  // namespace GridFormat
 
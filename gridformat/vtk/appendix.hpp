@@ -13,6 +13,8 @@
 #include <ostream>
 #include <string>
 #include <vector>
+#include <span>
+#include <optional>
 #include <memory>
 #include <limits>
 #include <type_traits>
@@ -65,6 +67,8 @@ class Appendix {
             return s;
         }
 
+        virtual std::optional<std::size_t> number_of_streamed_bytes(bool precompute) const = 0;
+
      private:
         virtual void stream(std::ostream& s) const = 0;
     };
@@ -76,6 +80,10 @@ class Appendix {
         : _data_array(std::move(arr))
         {}
 
+        std::optional<std::size_t> number_of_streamed_bytes(bool precompute) const override {
+            return _data_array.number_of_streamed_bytes(precompute);
+        }
+
      private:
         DataArray _data_array;
 
@@ -101,6 +109,26 @@ class Appendix {
         return s;
     }
 
+    /*!
+     * \brief Return the offsets of all data arrays within the appendix, in case
+     *        the sizes of all arrays are known before streaming them.
+     * \param precompute If true, compressed arrays are compressed to determine their sizes, and
+     *                   all of them are kept in memory until they are streamed.
+     */
+    std::optional<std::vector<std::size_t>> precomputed_offsets(bool precompute = false) const {
+        std::vector<std::size_t> offsets;
+        offsets.reserve(_content.size());
+        std::size_t offset = 0;
+        for (const auto& array_ptr : _content) {
+            const auto num_bytes = array_ptr->number_of_streamed_bytes(precompute);
+            if (!num_bytes)
+                return {};
+            offsets.push_back(offset);
+            offset += num_bytes.value();
+        }
+        return offsets;
+    }
+
     void set_observer(AppendixStreamObserver* observer) {
         _observer = observer;
     }
@@ -186,6 +214,18 @@ namespace XML::Detail {
         return offset_positions;
     }
 
+    void set_data_array_offsets(XMLElement& e,
+                                std::span<const std::size_t> offsets,
+                                std::size_t& count) {
+        if (e.name() == "DataArray") {
+            if (count >= offsets.size())
+                throw SizeError("Number of data arrays & precomputed offsets does not match");
+            e.set_attribute("offset", offsets[count++]);
+        }
+        for (auto& c : children(e))
+            set_data_array_offsets(c, offsets, count);
+    }
+
     template<typename Context, typename Encoder>
         requires(!std::is_const_v<std::remove_reference_t<Context>>)
     inline void write_with_appendix(Context&& context,
@@ -195,6 +235,23 @@ namespace XML::Detail {
         if (produces_valid_xml(encoder))
             s << "<?xml version=\"1.0\"?>\n";
 
+        // if the array sizes are known, write the header with the final offsets right away. Sizes of
+        // compressed arrays are only precomputed if we cannot seek back to patch the offsets later,
+        // since this requires holding all compressed arrays in memory at the same time.
+        const bool is_seekable = s.tellp() != std::ostream::pos_type(-1);
+        if (const auto offsets = context.appendix.precomputed_offsets(!is_seekable); offsets) {
+            std::size_t count = 0;
+            set_data_array_offsets(context.xml_representation, offsets.value(), count);
+            if (count != offsets->size())
+                throw SizeError("Number of data arrays & precomputed offsets does not match");
+
+            auto& app_element = context.xml_representation.add_child("AppendedData");
+            app_element.set_attribute("encoding", attribute_name(encoder));
+            app_element.set_content(Detail::XMLAppendixContent{context.appendix});
+            write_xml(context.xml_representation, s, indentation);
+            return;
+        }
+
         AppendixStreamObserver observer;
         context.appendix.set_observer(&observer);
 
@@ -17,7 +17,7 @@
 
 // forward declarations
 namespace GridFormat { class DynamicPrecision; }
-namespace GridFormat::Compression { class LZMA; class ZLIB; class LZ4; }
+namespace GridFormat::Compression { class LZMA; class ZLIB; class LZ4; class ZSTD; }
 namespace GridFormat::Encoding { struct Ascii; struct Base64; struct RawBinary; }
 // end forward declarations
 
@@ -42,6 +42,7 @@ std::string attribute_name(const Encoding::RawBinary&) { return "raw"; }
 std::string attribute_name(const Compression::LZMA&) { return "vtkLZMADataCompressor"; };
 std::string attribute_name(const Compression::ZLIB&) { return "vtkZLibDataCompressor"; };
 std::string attribute_name(const Compression::LZ4&) { return "vtkLZ4DataCompressor"; };
+std::string attribute_name(const Compression::ZSTD&) { return "vtkZstdDataCompressor"; };
 
 std::string data_format_name(const Encoding::RawBinary&, const DataFormat::Appended&) { return "appended"; }
 std::string data_format_name(const Encoding::Base64&, const DataFormat::Appended&) { return "appended"; }
@@ -15,8 +15,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/range_field.hpp>
+#include <gridformat/common/buffer_field.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/precision.hpp>
@@ -137,8 +142,55 @@ FieldPtr make_vtk_field(F&& field) {
     return make_vtk_field(make_field_ptr(std::forward<F>(field)));
 }
 
+namespace CommonDetail {
+
+    // Field exposing the values of a contiguous range provided by a grid (see e.g. Traits::Coordinates)
+    template<Concepts::Scalar T, std::ranges::contiguous_range R>
+    class ContiguousRangeField : public Field {
+        using ValueType = std::ranges::range_value_t<R>;
+
+     public:
+        template<typename _R> requires(std::convertible_to<_R, LVReferenceOrValue<R>>)
+        explicit ContiguousRangeField(_R&& values, MDLayout layout)
+        : _values{std::forward<_R>(values)}
+        , _md_layout{std::move(layout)} {
+            if (Ranges::size(_values) != _md_layout.number_of_entries())
+                throw SizeError("Number of values does not match the given layout");
+        }
+
+     private:
+        MDLayout _layout() const override { return _md_layout; }
+        DynamicPrecision _precision() const override { return Precision<T>{}; }
+        Serialization _serialized() const override {
+            Serialization serialization(sizeof(T)*_md_layout.number_of_entries());
+            T* data = serialization.as_span_of<T>().data();
+            if constexpr (std::is_same_v<std::remove_cv_t<ValueType>, T>)
+                std::copy_n(std::ranges::data(_values), Ranges::size(_values), data);
+            else
+                std::ranges::transform(_values, data, [] (const ValueType& v) { return static_cast<T>(v); });
+            return serialization;
+        }
+
+        LVReferenceOrValue<R> _values;
+        MDLayout _md_layout;
+    };
+
+    template<Concepts::Scalar T, typename R>
+    ContiguousRangeField<T, R> make_contiguous_range_field(R&& values, MDLayout layout) {
+        return ContiguousRangeField<T, R>{std::forward<R>(values), std::move(layout)};
+    }
+
+}  // namespace CommonDetail
+
 template<typename ctype, GridDetail::ExposesPointRange Grid>
 auto make_coordinates_field(const Grid& grid, bool structured_grid_ordering) {
+    if constexpr (GridDetail::ExposesCoordinates<Grid>) {
+        if (!structured_grid_ordering)
+            return make_vtk_field(CommonDetail::make_contiguous_range_field<ctype>(
+                GridFormat::Traits::Coordinates<Grid>::get(grid),
+                MDLayout{{number_of_points(grid), static_size<GridDetail::PointCoordinates<Grid>>}}
+            ));
+    }
     return make_vtk_field(PointField{
         grid,
         [&] (const auto& point) { return coordinates(grid, point); },
@@ -147,87 +199,200 @@ auto make_coordinates_field(const Grid& grid, bool structured_grid_ordering) {
     });
 }
 
+/*!
+ * \brief Return the map from point ids to running point indices to be passed to make_connectivity_field.
+ * \note Grids exposing their connectivity via Traits::Connectivity already refer to running point indices,
+ *       and thus, an empty map is returned for them.
+ */
+template<Concepts::UnstructuredGrid Grid>
+std::unordered_map<std::size_t, std::size_t> make_connectivity_point_id_map(const Grid& grid) {
+    if constexpr (GridDetail::ExposesConnectivity<Grid>)
+        return {};
+    else
+        return make_point_id_map(grid);
+}
+
 template<typename HeaderType = std::size_t, Concepts::UnstructuredGrid Grid, typename PointMap>
     requires(std::is_lvalue_reference_v<PointMap>)
 auto make_connectivity_field(const Grid& grid, PointMap&& map) {
-    class ConnectivityField : public Field {
-     public:
-        explicit ConnectivityField(const Grid& g, PointMap&& map)
-        : _grid(g)
-        , _point_map{std::forward<PointMap>(map)} {
-            _num_values = 0;
-            std::ranges::for_each(cells(g), [&] (const auto& cell) {
-                _num_values += number_of_points(_grid, cell);
-            });
-        }
-
-     private:
-        MDLayout _layout() const override { return MDLayout{{_num_values}}; }
-        DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
-        Serialization _serialized() const override {
-            Serialization serialization(sizeof(HeaderType)*_num_values);
-            HeaderType* data = serialization.as_span_of<HeaderType>().data();
-
-            std::size_t i = 0;
-            std::ranges::for_each(cells(_grid), [&] (const auto& cell) {
-                std::ranges::for_each(points(_grid, cell), [&] (const auto& point) {
-                    data[i] = _point_map.at(id(_grid, point));
-                    i++;
+    if constexpr (GridDetail::ExposesConnectivity<Grid>) {
+        auto&& connectivity = GridFormat::Traits::Connectivity<Grid>::get(grid);
+        const std::size_t num_values = Ranges::size(connectivity);
+        return make_vtk_field(CommonDetail::make_contiguous_range_field<HeaderType>(
+            std::forward<decltype(connectivity)>(connectivity),
+            MDLayout{{num_values}}
+        ));
+    } else {
+        class ConnectivityField : public Field {
+         public:
+            explicit ConnectivityField(const Grid& g, PointMap&& map)
+            : _grid(g)
+            , _point_map{std::forward<PointMap>(map)} {
+                _num_values = 0;
+                std::ranges::for_each(cells(g), [&] (const auto& cell) {
+                    _num_values += number_of_points(_grid, cell);
                 });
-            });
-            return serialization;
-        }
+            }
+
+         private:
+            MDLayout _layout() const override { return MDLayout{{_num_values}}; }
+            DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
+            Serialization _serialized() const override {
+                Serialization serialization(sizeof(HeaderType)*_num_values);
+                HeaderType* data = serialization.as_span_of<HeaderType>().data();
+
+                std::size_t i = 0;
+                std::ranges::for_each(cells(_grid), [&] (const auto& cell) {
+                    std::ranges::for_each(points(_grid, cell), [&] (const auto& point) {
+                        data[i] = _point_map.at(id(_grid, point));
+                        i++;
+                    });
+                });
+                return serialization;
+            }
 
-        const Grid& _grid;
-        LVReferenceOrValue<PointMap> _point_map;
-        HeaderType _num_values;
-    } _field{grid, std::forward<PointMap>(map)};
+            const Grid& _grid;
+            LVReferenceOrValue<PointMap> _point_map;
+            HeaderType _num_values;
+        } _field{grid, std::forward<PointMap>(map)};
 
-    return make_vtk_field(std::move(_field));
+        return make_vtk_field(std::move(_field));
+    }
 }
 
 template<typename HeaderType = std::size_t, Concepts::UnstructuredGrid Grid>
 auto make_offsets_field(const Grid& grid) {
-    class OffsetField : public Field {
-     public:
-        explicit OffsetField(const Grid& g)
-        : _grid(g)
-        , _num_cells{static_cast<HeaderType>(Ranges::size(cells(g)))}
-        {}
-
-     private:
-        MDLayout _layout() const override { return MDLayout{{_num_cells}}; }
-        DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
-        Serialization _serialized() const override {
-            Serialization serialization(sizeof(HeaderType)*_num_cells);
-            HeaderType* data = serialization.as_span_of<HeaderType>().data();
-
-            std::size_t i = 0;
-            HeaderType offset = 0;
-            std::ranges::for_each(cells(_grid), [&] (const auto& cell) {
-                offset += number_of_points(_grid, cell);
-                data[i] = offset;
-                i++;
-            });
-            return serialization;
-        }
+    if constexpr (GridDetail::ExposesOffsets<Grid>) {
+        return make_vtk_field(CommonDetail::make_contiguous_range_field<HeaderType>(
+            GridFormat::Traits::Offsets<Grid>::get(grid),
+            MDLayout{{number_of_cells(grid)}}
+        ));
+    } else {
+        class OffsetField : public Field {
+         public:
+            explicit OffsetField(const Grid& g)
+            : _grid(g)
+            , _num_cells{static_cast<HeaderType>(Ranges::size(cells(g)))}
+            {}
+
+         private:
+            MDLayout _layout() const override { return MDLayout{{_num_cells}}; }
+            DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
+            Serialization _serialized() const override {
+                Serialization serialization(sizeof(HeaderType)*_num_cells);
+                HeaderType* data = serialization.as_span_of<HeaderType>().data();
+
+                std::size_t i = 0;
+                HeaderType offset = 0;
+                std::ranges::for_each(cells(_grid), [&] (const auto& cell) {
+                    offset += number_of_points(_grid, cell);
+                    data[i] = offset;
+                    i++;
+                });
+                return serialization;
+            }
 
-        const Grid& _grid;
-        HeaderType _num_cells;
-    } _field{grid};
+            const Grid& _grid;
+            HeaderType _num_cells;
+        } _field{grid};
 
-    return make_vtk_field(std::move(_field));
+        return make_vtk_field(std::move(_field));
+    }
 }
 
 template<Concepts::UnstructuredGrid Grid>
 auto make_cell_types_field(const Grid& grid) {
-    return make_vtk_field(CellField{
-        grid,
-        [&] (const auto& cell) {
-            return VTK::cell_type_number(type(grid, cell));
-        },
-        false
-    });
+    if constexpr (GridDetail::ExposesCellTypes<Grid>) {
+        return make_vtk_field(RangeField{
+            GridFormat::Traits::CellTypes<Grid>::get(grid) | std::views::transform([] (const CellType& ct) {
+                return VTK::cell_type_number(ct);
+            })
+        });
+    } else {
+        return make_vtk_field(CellField{
+            grid,
+            [&] (const auto& cell) {
+                return VTK::cell_type_number(type(grid, cell));
+            },
+            false
+        });
+    }
+}
+
+//! Fields describing the topology of an unstructured grid (see make_topology_fields)
+struct TopologyFields {
+    FieldPtr connectivity;
+    FieldPtr offsets;
+    FieldPtr types;
+};
+
+/*!
+ * \brief Return the connectivity, offsets and cell types fields of the given grid.
+ * \details In contrast to using make_connectivity_field, make_offsets_field and make_cell_types_field,
+ *          the data of all fields that are not exposed via the bulk traits (see e.g. Traits::Connectivity)
+ *          is collected in a single traversal over the cells of the grid.
+ * \note The point map is only used within this function and does not need to outlive the returned fields.
+ */
+template<typename HeaderType = std::size_t, Concepts::UnstructuredGrid Grid, typename PointMap>
+    requires(std::is_lvalue_reference_v<PointMap>)
+TopologyFields make_topology_fields(const Grid& grid, PointMap&& map) {
+    static constexpr bool collect_connectivity = !GridDetail::ExposesConnectivity<Grid>;
+    static constexpr bool collect_offsets = !GridDetail::ExposesOffsets<Grid>;
+    static constexpr bool collect_types = !GridDetail::ExposesCellTypes<Grid>;
+    if constexpr (!collect_connectivity && !collect_offsets && !collect_types) {
+        return {
+            .connectivity = make_connectivity_field<HeaderType>(grid, map),
+            .offsets = make_offsets_field<HeaderType>(grid),
+            .types = make_cell_types_field(grid)
+        };
+    } else {
+        const std::size_t num_cells = number_of_cells(grid);
+        std::vector<HeaderType> connectivity;
+        std::vector<HeaderType> offsets;
+        std::vector<std::uint8_t> types;
+        if constexpr (collect_connectivity)
+            connectivity.reserve(num_cells);
+        if constexpr (collect_offsets)
+            offsets.reserve(num_cells);
+        if constexpr (collect_types)
+            types.reserve(num_cells);
+
+        HeaderType offset = 0;
+        std::ranges::for_each(cells(grid), [&] (const auto& cell) {
+            if constexpr (collect_connectivity) {
+                std::ranges::for_each(points(grid, cell), [&] (const auto& point) {
+                    connectivity.push_back(static_cast<HeaderType>(map.at(id(grid, point))));
+                });
+                offset = static_cast<HeaderType>(connectivity.size());
+            } else if constexpr (collect_offsets) {
+                offset += static_cast<HeaderType>(number_of_points(grid, cell));
+            }
+            if constexpr (collect_offsets)
+                offsets.push_back(offset);
+            if constexpr (collect_types)
+                types.push_back(VTK::cell_type_number(type(grid, cell)));
+        });
+
+        const auto make_buffer_field = [] <typename T> (std::vector<T>&& values) {
+            MDLayout layout{{values.size()}};
+            return make_field_ptr(BufferField<T>{std::move(values), std::move(layout)});
+        };
+
+        TopologyFields result;
+        if constexpr (collect_connectivity)
+            result.connectivity = make_buffer_field(std::move(connectivity));
+        else
+            result.connectivity = make_connectivity_field<HeaderType>(grid, map);
+        if constexpr (collect_offsets)
+            result.offsets = make_buffer_field(std::move(offsets));
+        else
+            result.offsets = make_offsets_field<HeaderType>(grid);
+        if constexpr (collect_types)
+            result.types = make_buffer_field(std::move(types));
+        else
+            result.types = make_cell_types_field(grid);
+        return result;
+    }
 }
 
 inline auto active_array_attribute_for_rank(unsigned int rank) {
@@ -362,30 +527,34 @@ namespace CommonDetail {
                                               const std::array<T, 3>& origin,
                                               const std::array<T, 3>& spacing,
                                               const std::array<T, 9>& direction) {
-        const MDLayout layout{{
+        const std::array<std::size_t, 3> counts{
             extents[1] - extents[0],
             extents[3] - extents[2],
             extents[5] - extents[4]
-        }};
-        const FlatIndexMapper mapper{layout};
+        };
         const auto piece_origin = compute_piece_origin(
             origin, spacing, {extents[0], extents[2], extents[4]}, direction
         );
 
         static constexpr unsigned int vtk_space_dim = 3;
-        Serialization result(layout.number_of_entries()*sizeof(T)*vtk_space_dim);
-        auto span_out = result.as_span_of(Precision<T>{});
-        for (const auto& md_index : MDIndexRange{layout}) {
-            const auto offset = mapper.map(md_index)*vtk_space_dim;
-            assert(offset + 2 < span_out.size());
-            std::ranges::copy(
-                compute_location(piece_origin, {
-                    static_cast<T>(md_index.get(0))*spacing[0],
-                    static_cast<T>(md_index.get(1))*spacing[1],
-                    static_cast<T>(md_index.get(2))*spacing[2]
-                }, direction),
-                span_out.data() + offset
-            );
+        Serialization result(counts[0]*counts[1]*counts[2]*sizeof(T)*vtk_space_dim);
+        T* out = result.as_span_of(Precision<T>{}).data();
+
+        // points are ordered with x running fastest, and the contributions of y and z
+        // are constant along each row. The summation order is that of compute_location.
+        for (std::size_t k = 0; k < counts[2]; ++k) {
+            const T z = static_cast<T>(k)*spacing[2];
+            const std::array<T, 3> z_part{z*direction[2], z*direction[5], z*direction[8]};
+            for (std::size_t j = 0; j < counts[1]; ++j) {
+                const T y = static_cast<T>(j)*spacing[1];
+                const std::array<T, 3> y_part{y*direction[1], y*direction[4], y*direction[7]};
+                for (std::size_t i = 0; i < counts[0]; ++i, out += vtk_space_dim) {
+                    const T x = static_cast<T>(i)*spacing[0];
+                    out[0] = piece_origin[0] + x*direction[0] + y_part[0] + z_part[0];
+                    out[1] = piece_origin[1] + x*direction[3] + y_part[1] + z_part[1];
+                    out[2] = piece_origin[2] + x*direction[6] + y_part[2] + z_part[2];
+                }
+            }
         }
         return result;
     }
@@ -411,38 +580,45 @@ namespace CommonDetail {
         if (grid_dim == 0)
             throw ValueError("Grid must be at least 1d");
 
-        const MDLayout point_layout{Ranges::incremented(counts, 1)};
-        const FlatIndexMapper point_mapper{point_layout};
-        const auto x_offset = grid_dim > 1 ? point_layout.extent(0) : std::size_t{0};
-        const auto y_offset = grid_dim > 2 ? point_layout.extent(0)*point_layout.extent(1) : std::size_t{0};
+        const std::size_t row_size = counts[0] + 1;
+        const std::size_t layer_size = row_size*(counts[1] + 1);
+        const auto x_offset = grid_dim > 1 ? row_size : std::size_t{0};
+        const auto y_offset = grid_dim > 2 ? layer_size : std::size_t{0};
 
-        // avoid zero counts s.t. the index range does not degenerate
+        // avoid zero counts s.t. the loops below do not degenerate
         std::ranges::for_each(counts, [] (std::size_t& count) { count = std::max(count, std::size_t{1}); });
-        std::vector<std::size_t> corners(std::pow(2, grid_dim), 0);
-
-        const MDIndexRange index_range{MDLayout{counts}};
-        if (grid_dim == 1) {
-            std::ranges::for_each(index_range, [&] (const auto& md_index) {
-                const auto p0 = point_mapper.map(md_index);
-                corners = {p0, p0 + 1};
-                visitor(grid_dim_to_cell_type[grid_dim], corners);
-            });
-        } else if (grid_dim == 2) {
-            std::ranges::for_each(index_range, [&] (const auto& md_index) {
-                const auto p0 = point_mapper.map(md_index);
-                corners = {p0, p0 + 1, p0 + x_offset, p0 + 1 + x_offset};
-                visitor(grid_dim_to_cell_type[grid_dim], corners);
-            });
-        } else {
-            std::ranges::for_each(index_range, [&] (const auto& md_index) {
-                const auto p0 = point_mapper.map(md_index);
-                corners = {
-                    p0, p0 + 1, p0 + x_offset, p0 + 1 + x_offset,
-                    p0 + y_offset, p0 + y_offset + 1, p0 + y_offset + x_offset, p0 + 1 + y_offset + x_offset
-                };
-                visitor(grid_dim_to_cell_type[grid_dim], corners);
-            });
-        }
+
+        // cells are visited with x running fastest, advancing the first corner incrementally
+        const auto visit = [&] <std::size_t dim> (std::integral_constant<std::size_t, dim>) {
+            const CellType cell_type = grid_dim_to_cell_type[dim];
+            std::vector<std::size_t> corners(std::size_t{1} << dim, 0);
+            for (std::size_t k = 0; k < counts[2]; ++k)
+                for (std::size_t j = 0; j < counts[1]; ++j) {
+                    std::size_t p0 = k*layer_size + j*row_size;
+                    for (std::size_t i = 0; i < counts[0]; ++i, ++p0) {
+                        corners[0] = p0;
+                        corners[1] = p0 + 1;
+                        if constexpr (dim > 1) {
+                            corners[2] = p0 + x_offset;
+                            corners[3] = p0 + 1 + x_offset;
+                        }
+                        if constexpr (dim > 2) {
+                            corners[4] = p0 + y_offset;
+                            corners[5] = p0 + y_offset + 1;
+                            corners[6] = p0 + y_offset + x_offset;
+                            corners[7] = p0 + 1 + y_offset + x_offset;
+                        }
+                        visitor(cell_type, corners);
+                    }
+                }
+        };
+
+        if (grid_dim == 1)
+            visit(std::integral_constant<std::size_t, 1>{});
+        else if (grid_dim == 2)
+            visit(std::integral_constant<std::size_t, 2>{});
+        else
+            visit(std::integral_constant<std::size_t, 3>{});
     }
 
 }  // namespace CommonDetail
@@ -8,49 +8,122 @@
 #ifndef GRIDFORMAT_VTK_DATA_ARRAY_HPP_
 #define GRIDFORMAT_VTK_DATA_ARRAY_HPP_
 
+#include <bit>
 #include <span>
 #include <utility>
 #include <ostream>
+#include <string>
 #include <vector>
+#include <variant>
+#include <optional>
 #include <iterator>
+#include <functional>
 #include <type_traits>
 
+#include <gridformat/common/field.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/serialization.hpp>
+
 #include <gridformat/encoding/ascii.hpp>
+#include <gridformat/encoding/raw.hpp>
+#include <gridformat/encoding/base64.hpp>
 #include <gridformat/encoding/concepts.hpp>
 #include <gridformat/encoding/encoded_field.hpp>
 #include <gridformat/compression/concepts.hpp>
+#include <gridformat/compression/pre_filter.hpp>
+#include <gridformat/compression/adaptive.hpp>
+#include <gridformat/vtk/attributes.hpp>
 
 namespace GridFormat::VTK {
 
+/*!
+ * \ingroup VTK
+ * \brief Payload of a binary data array as stored in a VTK-XML file, that is,
+ *        the encoded (and possibly compressed) header and values.
+ */
+struct DataArrayPayload {
+    std::string encoding;     //!< attribute name of the encoding (e.g. "base64")
+    std::string compressor;   //!< attribute name of the compressor (empty if uncompressed)
+    std::string header_type;  //!< attribute name of the header precision (e.g. "UInt64")
+    std::string pre_filter;   //!< string representation of the pre-filter (empty if none)
+    std::endian byte_order;
+    std::function<Serialization()> read;  //!< reads the payload from the file
+};
+
+/*!
+ * \ingroup VTK
+ * \brief Field read from a VTK-XML file, which additionally exposes the payload of the data array.
+ * \details When written with matching encoding, compression and header precision, the payload
+ *          is copied verbatim instead of decoding, decompressing and re-encoding the values.
+ */
+class PassThroughField : public Field {
+ public:
+    PassThroughField(FieldPtr field, DataArrayPayload payload)
+    : _field{std::move(field)}
+    , _payload{std::move(payload)}
+    {}
+
+    const DataArrayPayload& payload() const {
+        return _payload;
+    }
+
+ private:
+    MDLayout _layout() const override { return _field->layout(); }
+    DynamicPrecision _precision() const override { return _field->precision(); }
+    Serialization _serialized() const override { return _field->serialized(); }
+    void _prefetch() const override { _field->prefetch(); }
+
+    FieldPtr _field;
+    DataArrayPayload _payload;
+};
+
 /*!
  * \ingroup VTK
  * \brief Wraps a field and exposes it as VTK data array.
  *        Essentially, this implements the operator<< to stream
  *        the field data in the way that VTK file formats require it.
+ * \note An optional pre-filter (e.g. byte shuffling) is applied to the data before compression.
+ *       Files written with pre-filters can only be read by GridFormat.
+ * \note With Compression::Adaptive, the compressor is selected on the basis of the field data,
+ *       and the array is written uncompressed if none of the candidates pays off.
+ * \note The payload of a PassThroughField is copied verbatim if it was stored with the same
+ *       encoding, compressor, pre-filter and header precision (and native byte order).
  */
 template<typename Encoder,
          typename Compressor,
          typename HeaderType>
 class DataArray {
     static constexpr bool do_compression = !std::is_same_v<Compressor, None>;
+    static constexpr bool is_adaptive = std::is_same_v<Compressor, Compression::Adaptive>;
+    static constexpr bool is_binary = std::is_same_v<Encoder, GridFormat::Encoding::RawBinary>
+                                      || std::is_same_v<Encoder, GridFormat::Encoding::Base64>;
 
  public:
     DataArray(const Field& field,
               Encoder encoder,
               Compressor compressor,
-              [[maybe_unused]] const Precision<HeaderType>& = {})
+              [[maybe_unused]] const Precision<HeaderType>& = {},
+              Compression::PreFilter pre_filter = {})
     : _field(field)
     , _encoder{std::move(encoder)}
-    , _compressor{std::move(compressor)} {
-        // if no ascii formatting was specified by the user, set our defaults
+    , _compressor{std::move(compressor)}
+    , _pre_filter{std::move(pre_filter)} {
+        // use our defaults for the layout options that were not specified by the user
         if constexpr (std::is_same_v<Encoder, GridFormat::Encoding::Ascii>) {
-            if (_encoder.options() == GridFormat::AsciiFormatOptions{})
-                _encoder = _encoder.with({
-                    .delimiter = " ",
-                    .line_prefix = std::string(10, ' '),
-                    .entries_per_line = 15
-                });
+            static const GridFormat::AsciiFormatOptions defaults{};
+            auto opts = _encoder.options();
+            if (opts.delimiter == defaults.delimiter)
+                opts.delimiter = " ";
+            if (opts.line_prefix == defaults.line_prefix)
+                opts.line_prefix = std::string(10, ' ');
+            if (opts.entries_per_line == defaults.entries_per_line)
+                opts.entries_per_line = 15;
+            _encoder = _encoder.with(std::move(opts));
         }
+        if constexpr (is_binary && !is_adaptive)
+            if (const auto pass_through = dynamic_cast<const PassThroughField*>(&_field))
+                if (_can_copy(pass_through->payload()))
+                    _pass_through = &pass_through->payload();
     }
 
     friend std::ostream& operator<<(std::ostream& s, const DataArray& da) {
@@ -58,8 +131,53 @@ class DataArray {
         return s;
     }
 
+    /*!
+     * \brief Return the number of bytes this array occupies in the output, in case this
+     *        can be determined before streaming (which is the case for binary encodings).
+     * \param precompute If true, compressed data (or a copied payload) is processed to determine its size,
+     *                   and the result is cached until the array is streamed. Otherwise, the size is only
+     *                   returned if it is known without processing the data.
+     */
+    std::optional<std::size_t> number_of_streamed_bytes(bool precompute = false) const {
+        if constexpr (is_binary) {
+            if (_pass_through) {
+                if (!_payload && !precompute)
+                    return {};
+                if (!_payload)
+                    _payload = _pass_through->read();
+                return _payload->size();
+            }
+            if constexpr (do_compression) {
+                if (!_compressed && !precompute)
+                    return {};
+                if (!_compressed)
+                    _compressed = _compress();
+                return _number_of_encoded_bytes(_compressed->header.size()*sizeof(HeaderType))
+                    + _number_of_encoded_bytes(_compressed->data.size());
+            } else {
+                return _number_of_encoded_bytes(sizeof(HeaderType))
+                    + _number_of_encoded_bytes(_field.size_in_bytes());
+            }
+        } else {
+            return {};
+        }
+    }
+
+    /*!
+     * \brief Return the attribute name of the compressor selected for this array,
+     *        or an empty string if the array is written uncompressed.
+     * \note This compresses the data, which is cached until the array is streamed.
+     */
+    std::string selected_compressor() const requires(is_adaptive) {
+        if (!_compressed)
+            _compressed = _compress();
+        return _compressed->compressor;
+    }
+
     void stream(std::ostream& s) const {
-        if constexpr (std::is_same_v<Encoder, GridFormat::Encoding::Ascii>)
+        if (_pass_through)
+            _export_payload(s);
+        else if constexpr (std::is_same_v<Encoder, GridFormat::Encoding::Ascii>)
             _export_ascii(s, _encoder);
         else if constexpr (do_compression)
             _export_compressed_binary(s);
@@ -68,6 +186,41 @@ class DataArray {
     }
 
  private:
+    struct CompressedData {
+        std::vector<HeaderType> header;
+        Serialization data;
+        std::string compressor = "";  // only set for adaptive compression
+    };
+
+    static std::size_t _number_of_encoded_bytes(std::size_t number_of_bytes) {
+        // each write into a base64 stream is encoded (and padded) separately
+        if constexpr (std::is_same_v<Encoder, GridFormat::Encoding::Base64>)
+            return GridFormat::Base64::encoded_size(number_of_bytes);
+        else
+            return number_of_bytes;
+    }
+
+    bool _can_copy(const DataArrayPayload& payload) const {
+        return payload.byte_order == std::endian::native
+            && payload.encoding == attribute_name(_encoder)
+            && payload.header_type == attribute_name(DynamicPrecision{Precision<HeaderType>{}})
+            && payload.compressor == _compressor_name()
+            && payload.pre_filter == (do_compression ? Compression::as_string(_pre_filter) : "");
+    }
+
+    std::string _compressor_name() const {
+        if constexpr (do_compression)
+            return attribute_name(_compressor);
+        else
+            return "";
+    }
+
+    void _export_payload(std::ostream& s) const {
+        const Serialization payload = _payload ? *std::exchange(_payload, {}) : _pass_through->read();
+        const auto chars = payload.template as_span_of<char>();
+        s.write(chars.data(), static_cast<std::streamsize>(chars.size()));
+    }
+
     template<typename _Enc>
     void _export_ascii(std::ostream& s, _Enc encoder) const {
         s << EncodedField{_field, encoder};
@@ -80,26 +233,58 @@ class DataArray {
         s << EncodedField{_field, _encoder};
     }
 
-    void _export_compressed_binary(std::ostream& s) const requires(Concepts::Compressor<Compressor>) {
-        _field.precision().visit([&] <typename T> (const Precision<T>&) {
-            auto encoded = _encoder(s);
-            Serialization serialization = _field.serialized();
-            const auto blocks = _compressor.template compress<HeaderType>(serialization);
+    void _export_compressed_binary(std::ostream& s) const requires(do_compression) {
+        const CompressedData compressed = _compressed ? *std::exchange(_compressed, {}) : _compress();
+        auto encoded = _encoder(s);
+        encoded.write(std::span{compressed.header});
+        encoded.write(compressed.data.as_span());
+    }
+
+    CompressedData _compress() const requires(Concepts::Compressor<Compressor>) {
+        Serialization serialization = _field.serialized();
+        if (!_pre_filter.is_identity())
+            Compression::apply_pre_filter(_pre_filter, serialization, _field.precision());
+        return _compress_with(_compressor, std::move(serialization));
+    }
+
+    CompressedData _compress() const requires(is_adaptive) {
+        Serialization serialization = _field.serialized();
+        if (!_pre_filter.is_identity())
+            Compression::apply_pre_filter(_pre_filter, serialization, _field.precision());
+        return std::visit([&] <typename C> (const C& compressor) -> CompressedData {
+            if constexpr (is_none<C>) {
+                if (!_pre_filter.is_identity())
+                    Compression::undo_pre_filter(_pre_filter, serialization, _field.precision());
+                std::vector<HeaderType> header{static_cast<HeaderType>(serialization.size())};
+                return {std::move(header), std::move(serialization)};
+            } else {
+                auto result = _compress_with(compressor, std::move(serialization));
+                result.compressor = attribute_name(compressor);
+                return result;
+            }
+        }, _compressor.select(serialization.as_span()));
+    }
+
+    template<typename C>
+    CompressedData _compress_with(const C& compressor, Serialization serialization) const {
+        const auto blocks = compressor.template compress<HeaderType>(serialization);
 
-            std::vector<HeaderType> header;
-            header.reserve(blocks.compressed_block_sizes.size() + 3);
-            header.push_back(blocks.number_of_blocks);
-            header.push_back(blocks.block_size);
-            header.push_back(blocks.residual_block_size);
-            std::ranges::copy(blocks.compressed_block_sizes, std::back_inserter(header));
-            encoded.write(std::span{header});
-            encoded.write(serialization.as_span());
-        });
+        std::vector<HeaderType> header;
+        header.reserve(blocks.compressed_block_sizes.size() + 3);
+        header.push_back(blocks.number_of_blocks);
+        header.push_back(blocks.block_size);
+        header.push_back(blocks.residual_block_size);
+        std::ranges::copy(blocks.compressed_block_sizes, std::back_inserter(header));
+        return {std::move(header), std::move(serialization)};
     }
 
     const Field& _field;
     Encoder _encoder;
     Compressor _compressor;
+    Compression::PreFilter _pre_filter;
+    mutable std::optional<CompressedData> _compressed;
+    const DataArrayPayload* _pass_through = nullptr;
+    mutable std::optional<Serialization> _payload;
 };
 
 }  // namespace GridFormat::VTK
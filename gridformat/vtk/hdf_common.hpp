@@ -26,6 +26,8 @@ namespace VTK {
 struct HDFTransientOptions {
     bool static_grid = false; //!< Set to true the grid is the same for all time steps (will only be written once)
     bool static_meta_data = true; //!< Set to true if the metadata is same for all time steps (will only be written once)
+    bool detect_static_grid = true; //!< Set to true to skip writing the grid in steps in which it did not change (detected via hashes of the grid data)
+    bool detect_static_fields = true; //!< Set to true to skip writing point/cell fields in steps in which they did not change (detected via hashes of the field data)
 };
 
 }  // namespace VTK
@@ -247,6 +247,52 @@ class VTKHDFImageGridReader : public GridReader {
         });
     }
 
+    FieldPtr _cell_field_in_region(std::string_view name,
+                                   const typename GridReader::PieceLocation& region) const override {
+        return _field_in_region("VTKHDF/CellData/" + std::string{name}, region, false);
+    }
+
+    FieldPtr _point_field_in_region(std::string_view name,
+                                    const typename GridReader::PieceLocation& region) const override {
+        return _field_in_region("VTKHDF/PointData/" + std::string{name}, region, true);
+    }
+
+    // read only the hyperslab covering the region (datasets are accessed with the last coordinate first)
+    FieldPtr _field_in_region(const std::string& path,
+                              const typename GridReader::PieceLocation& region,
+                              bool is_point_field) const {
+        const auto selection = GridReaderDetail::select_structured(_piece_location, region, is_point_field);
+        const auto extents = _get_extents();
+        const auto num_components = _get_number_of_components(path);
+        const auto num_entities = selection.count[0]*selection.count[1]*selection.count[2];
+
+        HDF5::Slice slice;
+        if (_step_index) {
+            slice.offset.push_back(_step_index.value());
+            slice.count.push_back(1);
+        }
+        for (unsigned int dir = vtk_space_dim; dir-- > 0;)
+            if (extents[dir] != 0) {
+                slice.offset.push_back(selection.offset[dir]);
+                slice.count.push_back(selection.count[dir]);
+            }
+        if (num_components) {
+            slice.offset.push_back(0);
+            slice.count.push_back(num_components.value());
+        }
+
+        return make_field_ptr(VTKHDF::DataSetField{
+            _file.value(),
+            num_components ? MDLayout{{num_entities, num_components.value()}} : MDLayout{{num_entities}},
+            _file.value().get_precision(path).value(),
+            [p=path, s=std::move(slice)] (const HDF5File& file) {
+                return file.visit_dataset(p, [&] <typename F> (F&& field) {
+                    return FlattenedField{make_field_ptr(std::move(field))}.serialized();
+                }, s);
+            }
+        });
+    }
+
     FieldPtr _meta_data_field(std::string_view name) const override {
         const auto path = "VTKHDF/FieldData/" + std::string{name};
         const auto dims = _file.value().get_dimensions(path).value();
@@ -129,6 +129,8 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
     void _write(const std::string& filename_with_ext) const {
         if constexpr (is_transient)
             throw InvalidState("This overload only works for non-transient output");
+        else if (this->_writes_into_sink())
+            throw NotImplemented("VTKHDFImageGridWriter does not support export into sinks");
         HDF5File file{filename_with_ext, _comm, HDF5File::Mode::overwrite};
         _write_to(file);
     }
@@ -10,6 +10,7 @@
 #if GRIDFORMAT_HAVE_HIGH_FIVE
 
 #include <memory>
+#include <span>
 #include <ranges>
 #include <iterator>
 #include <type_traits>
@@ -95,6 +96,16 @@ class VTKHDFReader : public GridReader {
         return _access().meta_data_field(name);
     }
 
+    FieldPtr _cell_field_in_region(std::string_view name,
+                                   const typename GridReader::PieceLocation& region) const override {
+        return _access().cell_field(name, region);
+    }
+
+    FieldPtr _point_field_in_region(std::string_view name,
+                                    const typename GridReader::PieceLocation& region) const override {
+        return _access().point_field(name, region);
+    }
+
     std::size_t _number_of_cells() const override {
         return _access().number_of_cells();
     }
@@ -145,6 +156,24 @@ class VTKHDFReader : public GridReader {
         _copy_fields(names);
     }
 
+    std::vector<FieldPtr> _cell_field_history(std::string_view name,
+                                              std::span<const std::size_t> indices,
+                                              typename GridReader::FieldNames& names) override {
+        auto result = _access().cell_field_history(name, indices);
+        names.clear();
+        _copy_fields(names);
+        return result;
+    }
+
+    std::vector<FieldPtr> _point_field_history(std::string_view name,
+                                               std::span<const std::size_t> indices,
+                                               typename GridReader::FieldNames& names) override {
+        auto result = _access().point_field_history(name, indices);
+        names.clear();
+        _copy_fields(names);
+        return result;
+    }
+
     void _copy_fields(typename GridReader::FieldNames& names) {
         std::ranges::copy(cell_field_names(_access()), std::back_inserter(names.cell_fields));
         std::ranges::copy(point_field_names(_access()), std::back_inserter(names.point_fields));
@@ -9,6 +9,11 @@
 #define GRIDFORMAT_VTK_HDF_UNSTRUCTURED_GRID_READER_HPP_
 #if GRIDFORMAT_HAVE_HIGH_FIVE
 
+#include <span>
+#include <array>
+#include <memory>
+#include <vector>
+#include <string>
 #include <iterator>
 #include <optional>
 #include <algorithm>
@@ -19,6 +24,7 @@
 #include <cassert>
 
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/serialization.hpp>
 #include <gridformat/common/field_transformations.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/exceptions.hpp>
@@ -36,6 +42,51 @@ template<Concepts::Communicator Communicator = NullCommunicator>
 class VTKHDFUnstructuredGridReader : public GridReader {
     using HDF5File = HDF5::File<Communicator>;
     static constexpr std::size_t vtk_space_dim = 3;
+
+    // Contiguous runs of the (sorted and unique) requested entity indices
+    struct IndexRuns {
+        explicit IndexRuns(std::span<const std::size_t> indices) {
+            std::vector<std::size_t> sorted(indices.begin(), indices.end());
+            std::ranges::sort(sorted);
+            const auto [first, last] = std::ranges::unique(sorted);
+            sorted.erase(first, last);
+            for (std::size_t i = 0; i < sorted.size(); ++i)
+                if (runs.empty() || runs.back()[0] + runs.back()[1] != sorted[i])
+                    runs.push_back({sorted[i], 1});
+                else
+                    runs.back()[1]++;
+            std::ranges::transform(indices, std::back_inserter(positions), [&] (std::size_t idx) {
+                return static_cast<std::size_t>(std::ranges::lower_bound(sorted, idx) - sorted.begin());
+            });
+            number_of_unique_indices = sorted.size();
+        }
+
+        // Return the values at the requested indices, given a callback to read the values of a run
+        template<typename RunReader>
+        Serialization gather(const RunReader& read_run) const {
+            Serialization sorted_values;
+            for (const auto& [first, count] : runs) {
+                const auto run_values = read_run(first, count);
+                const auto old_size = sorted_values.size();
+                sorted_values.resize(old_size + run_values.size());
+                std::ranges::copy(run_values.as_span(), sorted_values.as_span().begin() + old_size);
+            }
+
+            const auto entry_size = number_of_unique_indices > 0 ? sorted_values.size()/number_of_unique_indices : 0;
+            Serialization result{positions.size()*entry_size};
+            for (std::size_t i = 0; i < positions.size(); ++i)
+                std::copy_n(
+                    sorted_values.as_span().begin() + positions[i]*entry_size,
+                    entry_size,
+                    result.as_span().begin() + i*entry_size
+                );
+            return result;
+        }
+
+        std::vector<std::array<std::size_t, 2>> runs;  // first index and number of indices
+        std::vector<std::size_t> positions;  // positions of the requested indices in the sorted ones
+        std::size_t number_of_unique_indices;
+    };
     static constexpr bool read_rank_piece_only = !std::is_same_v<Communicator, NullCommunicator>;
 
  public:
@@ -387,6 +438,79 @@ class VTKHDFUnstructuredGridReader : public GridReader {
         });
     }
 
+    std::vector<FieldPtr> _cell_field_history(std::string_view name,
+                                              std::span<const std::size_t> indices,
+                                              typename GridReader::FieldNames&) override {
+        return _field_history("CellData", "CellDataOffsets", "Cells", name, indices);
+    }
+
+    std::vector<FieldPtr> _point_field_history(std::string_view name,
+                                               std::span<const std::size_t> indices,
+                                               typename GridReader::FieldNames&) override {
+        return _field_history("PointData", "PointDataOffsets", "Points", name, indices);
+    }
+
+    // Return fields that read only the hyperslabs covering the requested entities at each step
+    std::vector<FieldPtr> _field_history(const std::string& group,
+                                         const std::string& offsets_group,
+                                         const std::string& entity_type,
+                                         std::string_view name,
+                                         std::span<const std::size_t> indices) const {
+        if (!_is_transient())
+            throw NotImplemented("The format read by '" + _name() + "' is not a sequence");
+
+        const auto& file = _access_file();
+        const std::string path = "VTKHDF/" + group + "/" + std::string{name};
+        const auto data_offsets = file.template read_dataset_to<std::vector<std::size_t>>(
+            "VTKHDF/Steps/" + offsets_group + "/" + std::string{name}
+        );
+        const auto piece_offsets = _piece_offsets_at_all_steps(entity_type);
+        const auto dimensions = file.get_dimensions(path).value();
+        const auto precision = file.get_precision(path).value();
+        const auto runs = std::make_shared<const IndexRuns>(indices);
+
+        auto layout_dimensions = dimensions;
+        layout_dimensions.at(0) = indices.size();
+        std::vector<FieldPtr> result;
+        for (std::size_t step = 0; step < _number_of_steps(); ++step)
+            result.push_back(make_field_ptr(VTKHDF::DataSetField{
+                file,
+                MDLayout{layout_dimensions},
+                precision,
+                [p=path, r=runs, d=dimensions, o=data_offsets.at(step) + piece_offsets.at(step)] (const HDF5File& f) {
+                    return r->gather([&] (std::size_t first, std::size_t count) {
+                        auto slice_offset = d;
+                        auto slice_count = d;
+                        std::ranges::fill(slice_offset, std::size_t{0});
+                        slice_offset.at(0) = o + first;
+                        slice_count.at(0) = count;
+                        return f.visit_dataset(p, [&] <typename F> (F&& field) {
+                            return field.serialized();
+                        }, HDF5::Slice{.offset = std::move(slice_offset), .count = std::move(slice_count)});
+                    });
+                }
+            }));
+        return result;
+    }
+
+    // offsets of the piece(s) read by this reader within the pieces of each step
+    std::vector<std::size_t> _piece_offsets_at_all_steps(const std::string& entity_type) const {
+        std::vector<std::size_t> result(_number_of_steps(), 0);
+        if constexpr (read_rank_piece_only) {
+            const auto& file = _access_file();
+            const auto part_offsets = file.template read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/PartOffsets");
+            const auto num_entities = file.template read_dataset_to<std::vector<std::size_t>>("/VTKHDF/NumberOf" + entity_type);
+            const auto my_rank = static_cast<std::size_t>(Parallel::rank(_comm));
+            for (std::size_t step = 0; step < result.size(); ++step)
+                result[step] = std::accumulate(
+                    num_entities.begin() + part_offsets.at(step),
+                    num_entities.begin() + part_offsets.at(step) + my_rank,
+                    std::size_t{0}
+                );
+        }
+        return result;
+    }
+
     template<Concepts::Scalar T>
     T _read_rank_scalar(const std::string& path, const std::size_t base_offset = 0) const {
         T result;
@@ -10,10 +10,19 @@
 #if GRIDFORMAT_HAVE_HIGH_FIVE
 
 #include <type_traits>
+#include <string>
 #include <ostream>
+#include <optional>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
 
 #include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/hash.hpp>
 #include <gridformat/common/md_layout.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/lazy_field.hpp>
+#include <gridformat/common/serialization.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/lvalue_reference.hpp>
 
@@ -53,6 +62,28 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         std::size_t point_offset;
     };
 
+    struct GridFields {
+        FieldPtr coordinates;
+        VTK::TopologyFields topology;
+    };
+
+    struct StepField {
+        std::string name;
+        FieldPtr field;  // null if the data of the previous step is reused
+    };
+
+    struct StepFields {
+        std::vector<StepField> point_fields;
+        std::vector<StepField> cell_fields;
+    };
+
+    struct FieldState {
+        std::uint64_t hash;
+        MDLayout layout;
+        DynamicPrecision precision;
+        std::size_t step;
+    };
+
  public:
     using Grid = G;
 
@@ -100,8 +131,10 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
     void _write(const std::string& filename_with_ext) const {
         if constexpr (is_transient)
             throw InvalidState("This overload only works for non-transient output");
+        else if (this->_writes_into_sink())
+            throw NotImplemented("VTKHDFUnstructuredGridWriter does not support export into sinks");
         HDF5File file{filename_with_ext, _comm, HDF5File::overwrite};
-        _write_to(file);
+        _write_to(file, _make_grid_fields(), _make_fields());
     }
 
     std::string _write(double t) {
@@ -112,7 +145,8 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
             HDF5File::clear(_timeseries_filename, _comm);
 
         HDF5File file{_timeseries_filename, _comm, HDF5File::append};
-        const auto offsets = _write_to(file);
+        const auto grid_fields = _make_step_grid_fields();
+        const auto offsets = _write_to(file, grid_fields, _make_step_fields());
 
         file.write_attribute(this->_step_count+1, "/VTKHDF/Steps/NSteps");
         file.write(std::array{t}, "VTKHDF/Steps/Values");
@@ -121,7 +155,7 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         file.write(std::vector{std::array{offsets.connectivity_offset}}, "VTKHDF/Steps/ConnectivityIdOffsets");
 
         file.write(std::vector{Parallel::size(_comm)}, "/VTKHDF/Steps/NumberOfParts");
-        if (this->_step_count > 0 && _transient_opts.static_grid) {
+        if (this->_step_count > 0 && !grid_fields) {
             file.write(
                 std::vector{_get_last_step_data(file, "PartOffsets")},
                 "/VTKHDF/Steps/PartOffsets"
@@ -136,20 +170,23 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         return _timeseries_filename;
     }
 
-    TimeSeriesOffsets _write_to(HDF5File& file) const {
+    // the grid data of the previous step is reused if no grid fields are given
+    TimeSeriesOffsets _write_to(HDF5File& file,
+                                const std::optional<GridFields>& grid_fields,
+                                const StepFields& fields) const {
         file.write_attribute(std::array<std::size_t, 2>{(is_transient ? 2 : 1), 0}, "/VTKHDF/Version");
         file.write_attribute("UnstructuredGrid", "/VTKHDF/Type");
 
         TimeSeriesOffsets offsets;
         const auto context = IOContext::from(this->grid(), _comm, root_rank);
         _write_num_cells_and_points(file, context);
-        offsets.point_offset = _write_coordinates(file, context);
-        offsets.connectivity_offset = _write_connectivity(file, context);
-        offsets.cell_offset = _write_types(file, context);
-        _write_offsets(file, context);
+        offsets.point_offset = _write_coordinates(file, context, grid_fields);
+        offsets.connectivity_offset = _write_connectivity(file, context, grid_fields);
+        offsets.cell_offset = _write_types(file, context, grid_fields);
+        _write_offsets(file, context, grid_fields);
         _write_meta_data(file);
-        _write_point_fields(file, context);
-        _write_cell_fields(file, context);
+        _write_point_fields(file, context, fields.point_fields);
+        _write_cell_fields(file, context, fields.cell_fields);
 
         return offsets;
     }
@@ -159,24 +196,118 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         _write_values(file, "/VTKHDF/NumberOfCells", std::vector{number_of_cells(this->grid())}, context);
     }
 
-    std::size_t _write_coordinates(HDF5File& file, const IOContext& context) const {
+    GridFields _make_grid_fields() const {
+        const auto point_id_map = VTK::make_connectivity_point_id_map(this->grid());
+        return {
+            .coordinates = VTK::make_coordinates_field<CT>(this->grid(), false),
+            .topology = VTK::make_topology_fields(this->grid(), point_id_map)
+        };
+    }
+
+    // Return the grid fields to be written in the current step, or an empty optional if the grid
+    // of the previous step can be reused because the grid is static or did not change on any rank
+    std::optional<GridFields> _make_step_grid_fields() {
+        if (this->_step_count > 0 && _transient_opts.static_grid)
+            return {};
+
+        auto grid_fields = _make_grid_fields();
+        if (_transient_opts.detect_static_grid) {
+            const auto hash = _hash(grid_fields);
+            const int is_unchanged = this->_step_count > 0 && _last_grid_hash == hash ? 1 : 0;
+            const auto num_unchanged = Parallel::sum(_comm, is_unchanged, root_rank);
+            _last_grid_hash = hash;
+            if (Parallel::broadcast(_comm, num_unchanged, root_rank) == Parallel::size(_comm))
+                return {};
+        }
+        return grid_fields;
+    }
+
+    StepFields _make_fields() const {
+        StepFields result;
+        for (const auto& name : this->_point_field_names())
+            result.point_fields.push_back({name, _reshape(VTK::make_vtk_field(this->_get_point_field_ptr(name)))});
+        for (const auto& name : this->_cell_field_names())
+            result.cell_fields.push_back({name, _reshape(VTK::make_vtk_field(this->_get_cell_field_ptr(name)))});
+        return result;
+    }
+
+    // Return the fields to be written in the current step, where the fields whose data is the
+    // same as in the previous step on all ranks are null (their previous data is referenced)
+    StepFields _make_step_fields() {
+        auto result = _make_fields();
+        if (_transient_opts.detect_static_fields) {
+            for (auto& step_field : result.point_fields)
+                _deduplicate(step_field, _point_field_states);
+            for (auto& step_field : result.cell_fields)
+                _deduplicate(step_field, _cell_field_states);
+        }
+        return result;
+    }
+
+    void _deduplicate(StepField& step_field, std::unordered_map<std::string, FieldState>& states) {
+        // serialize only once and write the serialized values in case the field changed
+        auto serialization = step_field.field->serialized();
+        FieldState state{
+            .hash = xxhash64(serialization.as_span()),
+            .layout = step_field.field->layout(),
+            .precision = step_field.field->precision(),
+            .step = this->_step_count
+        };
+
+        const auto it = states.find(step_field.name);
+        const int is_unchanged = it != states.end()
+            && it->second.step + 1 == this->_step_count
+            && it->second.hash == state.hash
+            && it->second.layout == state.layout
+            && it->second.precision == state.precision ? 1 : 0;
+        const auto num_unchanged = Parallel::sum(_comm, is_unchanged, root_rank);
+        if (Parallel::broadcast(_comm, num_unchanged, root_rank) == Parallel::size(_comm)) {
+            it->second.step = this->_step_count;
+            step_field.field = nullptr;
+            return;
+        }
+
+        step_field.field = make_field_ptr(LazyField{
+            std::move(serialization),
+            state.layout,
+            state.precision,
+            [] (const Serialization& values) { return values; }
+        });
+        states.insert_or_assign(step_field.name, std::move(state));
+    }
+
+    static std::uint64_t _hash(const GridFields& grid_fields) {
+        std::uint64_t hash = 0;
+        for (const auto& field : {
+            grid_fields.coordinates,
+            grid_fields.topology.connectivity,
+            grid_fields.topology.offsets,
+            grid_fields.topology.types
+        })
+            hash = xxhash64(field->serialized().as_span(), hash);
+        return hash;
+    }
+
+    std::size_t _write_coordinates(HDF5File& file,
+                                   const IOContext& context,
+                                   const std::optional<GridFields>& grid_fields) const {
         if constexpr (is_transient) {
-            if (this->_step_count > 0 && _transient_opts.static_grid)
+            if (!grid_fields)
                 return _get_last_step_data(file, "PointOffsets");
         }
-        const auto coords_field = VTK::make_coordinates_field<CT>(this->grid(), false);
         const auto offset = _get_current_offset(file, "/VTKHDF/Points");
-        _write_point_field(file, "/VTKHDF/Points", *coords_field, context);
+        _write_point_field(file, "/VTKHDF/Points", *grid_fields.value().coordinates, context);
         return offset;
     }
 
-    std::size_t _write_connectivity(HDF5File& file, const IOContext& context) const {
+    std::size_t _write_connectivity(HDF5File& file,
+                                    const IOContext& context,
+                                    const std::optional<GridFields>& grid_fields) const {
         if constexpr (is_transient) {
-            if (this->_step_count > 0 && _transient_opts.static_grid)
+            if (!grid_fields)
                 return _get_last_step_data(file, "ConnectivityIdOffsets");
         }
-        const auto point_id_map = make_point_id_map(this->grid());
-        const auto connectivity_field = VTK::make_connectivity_field(this->grid(), point_id_map);
+        const auto& connectivity_field = grid_fields.value().topology.connectivity;
         const auto num_entries = connectivity_field->layout().number_of_entries();
         const auto my_num_ids = std::vector{static_cast<long>(num_entries)};
         std::vector<long> connectivity(num_entries);
@@ -187,12 +318,14 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         return offset;
     }
 
-    std::size_t _write_types(HDF5File& file, const IOContext& context) const {
+    std::size_t _write_types(HDF5File& file,
+                             const IOContext& context,
+                             const std::optional<GridFields>& grid_fields) const {
         if constexpr (is_transient) {
-            if (this->_step_count > 0 && _transient_opts.static_grid)
+            if (!grid_fields)
                 return _get_last_step_data(file, "CellOffsets");
         }
-        const auto types_field = VTK::make_cell_types_field(this->grid());
+        const auto& types_field = grid_fields.value().topology.types;
         std::vector<std::uint8_t> types(types_field->layout().number_of_entries());
         types_field->export_to(types);
         const auto offset = _get_current_offset(file, "VTKHDF/Types");
@@ -200,12 +333,14 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         return offset;
     }
 
-    std::size_t _write_offsets(HDF5File& file, const IOContext& context) const {
+    std::size_t _write_offsets(HDF5File& file,
+                               const IOContext& context,
+                               const std::optional<GridFields>& grid_fields) const {
         if constexpr (is_transient) {
-            if (this->_step_count > 0 && _transient_opts.static_grid)
+            if (!grid_fields)
                 return _get_last_step_data(file, "CellOffsets");
         }
-        const auto offsets_field = VTK::make_offsets_field(this->grid());
+        const auto& offsets_field = grid_fields.value().topology.offsets;
         const auto num_offset_entries = offsets_field->layout().number_of_entries() + 1;
         std::vector<long> offsets(num_offset_entries);
         offsets_field->export_to(std::ranges::subrange(std::next(offsets.begin()), offsets.end()));
@@ -233,29 +368,37 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         });
     }
 
-    void _write_point_fields(HDF5File& file, const IOContext& context) const {
-        std::ranges::for_each(this->_point_field_names(), [&] (const std::string& name) {
+    void _write_point_fields(HDF5File& file,
+                             const IOContext& context,
+                             const std::vector<StepField>& fields) const {
+        std::ranges::for_each(fields, [&] (const StepField& step_field) {
             if constexpr (is_transient)
                 _write_step_offset(
                     file,
-                    _get_current_offset(file, "/VTKHDF/PointData/" + name),
-                    "/VTKHDF/Steps/PointDataOffsets/" + name
+                    step_field.field
+                        ? _get_current_offset(file, "/VTKHDF/PointData/" + step_field.name)
+                        : _get_last_step_data(file, "PointDataOffsets/" + step_field.name),
+                    "/VTKHDF/Steps/PointDataOffsets/" + step_field.name
                 );
-            auto reshaped = _reshape(VTK::make_vtk_field(this->_get_point_field_ptr(name)));
-            _write_point_field(file, "/VTKHDF/PointData/" + name, *reshaped, context);
+            if (step_field.field)
+                _write_point_field(file, "/VTKHDF/PointData/" + step_field.name, *step_field.field, context);
         });
     }
 
-    void _write_cell_fields(HDF5File& file, const IOContext& context) const {
-        std::ranges::for_each(this->_cell_field_names(), [&] (const std::string& name) {
+    void _write_cell_fields(HDF5File& file,
+                            const IOContext& context,
+                            const std::vector<StepField>& fields) const {
+        std::ranges::for_each(fields, [&] (const StepField& step_field) {
             if constexpr (is_transient)
                 _write_step_offset(
                     file,
-                    _get_current_offset(file, "VTKHDF/CellData/" + name),
-                    "/VTKHDF/Steps/CellDataOffsets/" + name
+                    step_field.field
+                        ? _get_current_offset(file, "VTKHDF/CellData/" + step_field.name)
+                        : _get_last_step_data(file, "CellDataOffsets/" + step_field.name),
+                    "/VTKHDF/Steps/CellDataOffsets/" + step_field.name
                 );
-            auto reshaped = _reshape(VTK::make_vtk_field(this->_get_cell_field_ptr(name)));
-            _write_cell_field(file, "/VTKHDF/CellData/" + name, *reshaped, context);
+            if (step_field.field)
+                _write_cell_field(file, "/VTKHDF/CellData/" + step_field.name, *step_field.field, context);
         });
     }
 
@@ -376,6 +519,9 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
     Communicator _comm;
     std::string _timeseries_filename = "";
     VTK::HDFTransientOptions _transient_opts;
+    std::optional<std::uint64_t> _last_grid_hash;
+    std::unordered_map<std::string, FieldState> _point_field_states;
+    std::unordered_map<std::string, FieldState> _cell_field_states;
 };
 
 /*!
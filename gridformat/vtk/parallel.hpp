@@ -18,6 +18,7 @@
 #include <numeric>
 #include <tuple>
 #include <cmath>
+#include <optional>
 
 #include <gridformat/common/math.hpp>
 #include <gridformat/common/exceptions.hpp>
@@ -40,6 +41,11 @@ namespace GridFormat::PVTK {
     return base_name + "-" + std::to_string(rank);
 }
 
+//! Options for merging the pieces of groups of consecutive ranks into one piece file per group
+struct PieceAggregation {
+    unsigned int ranks_per_file = 1;  //!< Number of ranks whose pieces are merged (1 = one file per rank)
+};
+
 //! Helper to add a PDataArray child to an xml element
 template<typename Encoder, typename DataFormat>
 class PDataArrayHelper {
@@ -246,6 +252,7 @@ class StructuredParallelGridHelper {
     , _root_rank{root_rank}
     {}
 
+    //! Compute the decomposition on the root rank from the data gathered on it
     template<Concepts::Scalar CT,
              std::size_t dim,
              Concepts::StaticallySizedMDRange<2> B = std::array<std::array<CT, dim>, dim>>
@@ -253,41 +260,59 @@ class StructuredParallelGridHelper {
                                     const std::vector<std::size_t>& all_extents,
                                     const std::array<bool, dim>& is_negative_axis,
                                     const B& basis = GridDetail::standard_basis<CT, dim>()) const {
+        if (Parallel::rank(_comm) == _root_rank)
+            return compute_decomposition(all_origins, all_extents, is_negative_axis, basis);
+
+        const auto num_ranks = Parallel::size(_comm);
+        return std::make_tuple(
+            std::vector<std::array<std::size_t, dim>>(num_ranks),
+            std::vector<std::array<std::size_t, dim>>(num_ranks),
+            std::array<std::size_t, dim>{},
+            std::array<CT, dim>{}
+        );
+    }
+
+    //! Compute the decomposition on this rank, requires the data of all ranks (e.g. from Parallel::all_gather)
+    template<Concepts::Scalar CT,
+             std::size_t dim,
+             Concepts::StaticallySizedMDRange<2> B = std::array<std::array<CT, dim>, dim>>
+    auto compute_decomposition(const std::vector<CT>& all_origins,
+                               const std::vector<std::size_t>& all_extents,
+                               const std::array<bool, dim>& is_negative_axis,
+                               const B& basis = GridDetail::standard_basis<CT, dim>()) const {
         const auto num_ranks = Parallel::size(_comm);
         std::vector<std::array<std::size_t, dim>> pieces_begin(num_ranks);
         std::vector<std::array<std::size_t, dim>> pieces_end(num_ranks);
         std::array<std::size_t, dim> whole_extent;
         std::array<CT, dim> origin;
 
-        if (Parallel::rank(_comm) == _root_rank) {
-            const auto default_epsilon = 1e-6*std::ranges::max(all_origins | std::views::transform([] (CT v) {
-                using std::abs;
-                return abs(v);
-            }));
-            const auto mapper_helper = _make_mapper_helper(basis, all_origins, is_negative_axis, default_epsilon);
-            const auto rank_mapper = mapper_helper.make_mapper();
-            origin = mapper_helper.compute_origin();
-
-            for (unsigned dir = 0; dir < dim; ++dir) {
-                for (int rank = 0; rank < num_ranks; ++rank) {
-                    auto ranks_below = rank_mapper.ranks_below(rank_mapper.location(rank), dir);
-                    const std::size_t offset = std::accumulate(
-                        std::ranges::begin(ranks_below),
-                        std::ranges::end(ranks_below),
-                        std::size_t{0},
-                        [&] (const std::size_t current, int r) {
-                            return current + Parallel::access_gathered<dim>(all_extents, _comm, {dir, r});
-                        }
-                    );
-                    pieces_begin[rank][dir] = offset;
-                    pieces_end[rank][dir] = offset + Parallel::access_gathered<dim>(all_extents, _comm, {dir, rank});
-                }
+        const CT default_epsilon = static_cast<CT>(1e-6)*std::ranges::max(all_origins | std::views::transform([] (CT v) {
+            using std::abs;
+            return abs(v);
+        }));
+        const auto mapper_helper = _make_mapper_helper(basis, all_origins, is_negative_axis, default_epsilon);
+        const auto rank_mapper = mapper_helper.make_mapper();
+        origin = mapper_helper.compute_origin();
 
-                whole_extent[dir] = (*std::max_element(
-                    pieces_end.begin(), pieces_end.end(),
-                    [&] (const auto& a1, const auto& a2) { return a1[dir] < a2[dir]; }
-                ))[dir];
+        for (unsigned dir = 0; dir < dim; ++dir) {
+            for (int rank = 0; rank < num_ranks; ++rank) {
+                auto ranks_below = rank_mapper.ranks_below(rank_mapper.location(rank), dir);
+                const std::size_t offset = std::accumulate(
+                    std::ranges::begin(ranks_below),
+                    std::ranges::end(ranks_below),
+                    std::size_t{0},
+                    [&] (const std::size_t current, int r) {
+                        return current + Parallel::access_gathered<dim>(all_extents, _comm, {dir, r});
+                    }
+                );
+                pieces_begin[rank][dir] = offset;
+                pieces_end[rank][dir] = offset + Parallel::access_gathered<dim>(all_extents, _comm, {dir, rank});
             }
+
+            whole_extent[dir] = (*std::max_element(
+                pieces_end.begin(), pieces_end.end(),
+                [&] (const auto& a1, const auto& a2) { return a1[dir] < a2[dir]; }
+            ))[dir];
         }
 
         return std::make_tuple(
@@ -320,6 +345,63 @@ class StructuredParallelGridHelper {
     int _root_rank;
 };
 
+/*!
+ * \brief Computes the decomposition of a structured parallel grid into the pieces of all ranks,
+ *        and caches it for subsequent writes in which the pieces on all ranks are unchanged.
+ * \note Whether or not the cache is valid is decided collectively, such that each call requires
+ *       a single all-gather of a flag if the pieces are unchanged. Otherwise, the origins and
+ *       extents of all pieces are all-gathered and the decomposition is computed on each rank.
+ */
+template<Concepts::Scalar CT, std::size_t dim>
+class StructuredGridDecompositionCache {
+ public:
+    struct Decomposition {
+        std::vector<std::array<std::size_t, dim>> pieces_begin;
+        std::vector<std::array<std::size_t, dim>> pieces_end;
+        std::array<std::size_t, dim> whole_extent;
+        std::array<CT, dim> origin;
+    };
+
+    template<Concepts::Communicator Communicator,
+             Concepts::StaticallySizedMDRange<2> B = std::array<std::array<CT, dim>, dim>>
+    const Decomposition& get(const Communicator& comm,
+                             const std::array<CT, dim>& local_origin,
+                             const std::array<std::size_t, dim>& local_extents,
+                             const std::array<bool, dim>& is_negative_axis,
+                             const B& basis = GridDetail::standard_basis<CT, dim>()) {
+        PieceKey key{local_origin, local_extents, is_negative_axis, {}};
+        std::ranges::copy(basis | std::views::join, key.basis.begin());
+
+        const int is_valid = _decomposition.has_value() && _key == key ? 1 : 0;
+        const auto all_valid = Parallel::all_gather(comm, is_valid);
+        if (std::ranges::all_of(all_valid, [] (int v) { return v == 1; }))
+            return _decomposition.value();
+
+        auto [begin, end, whole_extent, origin] = StructuredParallelGridHelper{comm}.compute_decomposition(
+            Parallel::all_gather(comm, local_origin),
+            Parallel::all_gather(comm, local_extents),
+            is_negative_axis,
+            basis
+        );
+        _decomposition = Decomposition{std::move(begin), std::move(end), whole_extent, origin};
+        _key = std::move(key);
+        return _decomposition.value();
+    }
+
+ private:
+    struct PieceKey {
+        std::array<CT, dim> origin;
+        std::array<std::size_t, dim> extents;
+        std::array<bool, dim> is_negative_axis;
+        std::array<CT, dim*dim> basis;
+
+        friend bool operator==(const PieceKey&, const PieceKey&) = default;
+    };
+
+    std::optional<Decomposition> _decomposition;
+    PieceKey _key;
+};
+
 }  // namespace GridFormat::PVTK
 
 #endif  // GRIDFORMAT_VTK_PARALLEL_HPP_
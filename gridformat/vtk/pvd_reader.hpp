@@ -8,14 +8,22 @@
 #ifndef GRIDFORMAT_VTK_PVD_READER_HPP_
 #define GRIDFORMAT_VTK_PVD_READER_HPP_
 
+#include <list>
+#include <span>
+#include <ranges>
+#include <atomic>
 #include <memory>
+#include <future>
+#include <utility>
 #include <optional>
+#include <algorithm>
 #include <filesystem>
 #include <functional>
 #include <type_traits>
 #include <iterator>
 
 #include <gridformat/common/string_conversion.hpp>
+#include <gridformat/common/concurrency.hpp>
 #include <gridformat/parallel/communication.hpp>
 #include <gridformat/grid/reader.hpp>
 #include <gridformat/vtk/xml.hpp>
@@ -34,9 +42,18 @@
 
 namespace GridFormat {
 
+//! Options for the PVDReader
+struct PVDReaderOptions {
+    std::size_t step_cache_size = 4;  //!< number of opened step readers kept for revisiting steps (at least one)
+    bool prefetch_next_step = false;  //!< open the reader for the next step on a separate thread (sequential runs only)
+};
+
 /*!
  * \ingroup VTK
  * \brief Reader for .pvd time series file format
+ * \details The readers for the most recently visited steps are kept open, such that switching
+ *          back to one of them does not require parsing its file again. Optionally, the reader
+ *          for the step after the current one is opened in the background (see PVDReaderOptions).
  */
 template<Concepts::Communicator C = NullCommunicator>
 class PVDReader : public GridReader {
@@ -73,6 +90,16 @@ class PVDReader : public GridReader {
     , _step_reader_factory{std::move(f)}
     {}
 
+    //! Set the options for caching and prefetching step readers
+    void set_options(PVDReaderOptions opts) {
+        _opts = std::move(opts);
+        _trim_cache();
+    }
+
+    const PVDReaderOptions& options() const {
+        return _opts;
+    }
+
  private:
     StepReaderFactory _make_default_step_reader_factory() const {
         if constexpr (is_parallel)
@@ -149,6 +176,16 @@ class PVDReader : public GridReader {
         return _access_reader().meta_data_field(name);
     }
 
+    virtual FieldPtr _cell_field_in_region(std::string_view name,
+                                           const typename GridReader::PieceLocation& region) const override {
+        return _access_reader().cell_field(name, region);
+    }
+
+    virtual FieldPtr _point_field_in_region(std::string_view name,
+                                            const typename GridReader::PieceLocation& region) const override {
+        return _access_reader().point_field(name, region);
+    }
+
     virtual void _visit_cells(const typename GridReader::CellVisitor& visitor) const override {
         _access_reader().visit_cells(visitor);
     }
@@ -196,6 +233,44 @@ class PVDReader : public GridReader {
         _read_current_field_names(names);
     }
 
+    std::vector<FieldPtr> _cell_field_history(std::string_view name,
+                                              std::span<const std::size_t> indices,
+                                              typename GridReader::FieldNames&) override {
+        return _field_history(indices, [n=std::string{name}] (const GridReader& r) { return r.cell_field(n); });
+    }
+
+    std::vector<FieldPtr> _point_field_history(std::string_view name,
+                                               std::span<const std::size_t> indices,
+                                               typename GridReader::FieldNames&) override {
+        return _field_history(indices, [n=std::string{name}] (const GridReader& r) { return r.point_field(n); });
+    }
+
+    // Read the requested entries of all steps with separate readers, which (in sequential runs) are
+    // opened and decoded concurrently. This does not change the current step.
+    template<typename FieldGetter>
+    std::vector<FieldPtr> _field_history(std::span<const std::size_t> indices, const FieldGetter& get_field) const {
+        const std::vector<std::size_t> entity_indices(indices.begin(), indices.end());
+        std::vector<FieldPtr> result(_steps.size());
+        const auto read_step = [&] (std::size_t step_idx) {
+            const auto reader = _open_step_reader(step_idx);
+            auto field = GridReaderDetail::select_entries(get_field(*reader), entity_indices);
+            field->prefetch();
+            result[step_idx] = std::move(field);
+        };
+
+        if (Parallel::size(_communicator) > 1) {
+            std::ranges::for_each(std::views::iota(std::size_t{0}, _steps.size()), read_step);
+            return result;
+        }
+
+        std::atomic<std::size_t> next_step{0};
+        run_concurrently(std::min(hardware_concurrency(), _steps.size()), [&] (std::size_t) {
+            for (std::size_t step_idx = next_step++; step_idx < _steps.size(); step_idx = next_step++)
+                read_step(step_idx);
+        });
+        return result;
+    }
+
     void _read_steps(const std::string& filename) {
         auto helper = VTK::XMLReaderHelper::make_from(filename, "Collection");
         for (const auto& data_set : children(helper.get("Collection")) | std::views::filter([] (const XMLElement& e) {
@@ -215,9 +290,55 @@ class PVDReader : public GridReader {
     }
 
     void _make_step_reader() {
-        const std::string& filename = _steps.at(_step_index).filename;
-        _step_reader = _invoke_reader_factory(filename);
-        _step_reader->open(filename);
+        const auto it = std::ranges::find(_step_readers, _step_index, &CachedReader::first);
+        if (it != _step_readers.end())
+            _step_readers.splice(_step_readers.begin(), _step_readers, it);
+        else
+            _step_readers.emplace_front(_step_index, _take_prefetched_or_open(_step_index));
+        _trim_cache();
+        _prefetch_next_step();
+    }
+
+    std::unique_ptr<GridReader> _open_step_reader(std::size_t step_idx) const {
+        const std::string& filename = _steps.at(step_idx).filename;
+        auto reader = _invoke_reader_factory(filename);
+        reader->open(filename);
+        return reader;
+    }
+
+    std::unique_ptr<GridReader> _take_prefetched_or_open(std::size_t step_idx) {
+        if (_prefetched && _prefetched->first == step_idx) {
+            auto future = std::move(_prefetched->second);
+            _prefetched.reset();
+            try {
+                return future.get();
+            } catch (...) {
+                // open the reader again on this thread to report the error from here
+            }
+        }
+        return _open_step_reader(step_idx);
+    }
+
+    void _prefetch_next_step() {
+        if (!_opts.prefetch_next_step || Parallel::size(_communicator) > 1)
+            return;
+
+        const std::size_t next = _step_index + 1;
+        if (next >= _steps.size())
+            return;
+        if (_prefetched && _prefetched->first == next)
+            return;
+        if (std::ranges::any_of(_step_readers, [&] (const auto& r) { return r.first == next; }))
+            return;
+        _prefetched.reset();  // waits for a possibly running prefetch
+        _prefetched.emplace(next, std::async(std::launch::async, [this, next] () {
+            return _open_step_reader(next);
+        }));
+    }
+
+    void _trim_cache() {
+        while (_step_readers.size() > std::max(_opts.step_cache_size, std::size_t{1}))
+            _step_readers.pop_back();
     }
 
     std::unique_ptr<GridReader> _invoke_reader_factory(const std::string& filename) const {
@@ -234,22 +355,28 @@ class PVDReader : public GridReader {
     }
 
     void _reset() {
-        _step_reader.reset();
+        _prefetched.reset();
+        _step_readers.clear();
         _steps.clear();
         _step_index = 0;
     }
 
     const GridReader& _access_reader() const {
-        if (!_step_reader)
+        if (_step_readers.empty())
             throw ValueError("No data available");
-        return *_step_reader;
+        return *_step_readers.front().second;
     }
 
+    using CachedReader = std::pair<std::size_t, std::unique_ptr<GridReader>>;
+    using PrefetchedReader = std::pair<std::size_t, std::future<std::unique_ptr<GridReader>>>;
+
     C _communicator;
     StepReaderFactory _step_reader_factory;
-    std::unique_ptr<GridReader> _step_reader;
+    PVDReaderOptions _opts;
+    std::list<CachedReader> _step_readers;  // most recently used first
     std::vector<Step> _steps;
     std::size_t _step_index = 0;
+    std::optional<PrefetchedReader> _prefetched;  // declared last s.t. it is joined before the other members are destroyed
 };
 
 }  // namespace GridFormat
@@ -10,7 +10,6 @@
 
 #include <ostream>
 #include <string>
-#include <fstream>
 #include <algorithm>
 #include <filesystem>
 #include <array>
@@ -43,7 +42,6 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
     using CT = CoordinateType<Grid>;
 
     static constexpr std::size_t dim = dimension<Grid>;
-    static constexpr int root_rank = 0;
 
  public:
     explicit PVTIWriter(LValueReferenceOf<const Grid> grid,
@@ -59,6 +57,7 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
 
  private:
     Communicator _comm;
+    mutable PVTK::StructuredGridDecompositionCache<CT, dim> _decomposition;
 
     PVTIWriter _with(VTK::XMLOptions xml_opts) const override {
         return PVTIWriter{this->grid(), _comm, std::move(xml_opts)};
@@ -67,33 +66,33 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
     void _write(std::ostream&) const override {
         throw InvalidState(
             "PVTIWriter does not support direct export into stream. "
-            "Use overload with filename instead!"
+            "Use overload with filename (and optionally a sink) instead!"
         );
     }
 
     virtual void _write(const std::string& filename_with_ext) const override {
-        const auto& local_origin = origin(this->grid());
-        const auto& local_extents = extents(this->grid());
-
-        PVTK::StructuredParallelGridHelper helper{_comm};
-        const auto all_origins = Parallel::gather(_comm, local_origin, root_rank);
-        const auto all_extents = Parallel::gather(_comm, local_extents, root_rank);
-        const auto is_negative_axis = VTK::CommonDetail::structured_grid_axis_orientation(spacing(this->grid()));
-        const auto [exts_begin, exts_end, whole_extent, origin] = helper.compute_extents_and_origin(
-            all_origins,
-            all_extents,
-            is_negative_axis,
+        const auto& decomposition = _decomposition.get(
+            _comm,
+            Ranges::to_array<dim, CT>(origin(this->grid())),
+            Ranges::to_array<dim, std::size_t>(extents(this->grid())),
+            VTK::CommonDetail::structured_grid_axis_orientation(spacing(this->grid())),
             basis(this->grid())
         );
 
-        const auto my_whole_extent = Parallel::broadcast(_comm, whole_extent, root_rank);
-        const auto my_whole_origin = Parallel::broadcast(_comm, origin, root_rank);
-        const auto my_extent_offset = Parallel::scatter(_comm, Ranges::flat(exts_begin), root_rank);
-
-        _write_piece(filename_with_ext, Ranges::to_array<dim>(my_extent_offset), {my_whole_origin, my_whole_extent});
+        _write_piece(
+            filename_with_ext,
+            decomposition.pieces_begin.at(Parallel::rank(_comm)),
+            {decomposition.origin, decomposition.whole_extent}
+        );
         Parallel::barrier(_comm);  // ensure all pieces finished successfully
         if (Parallel::rank(_comm) == 0)
-            _write_pvti_file(filename_with_ext, my_whole_origin, my_whole_extent, exts_begin, exts_end);
+            _write_pvti_file(
+                filename_with_ext,
+                decomposition.origin,
+                decomposition.whole_extent,
+                decomposition.pieces_begin,
+                decomposition.pieces_end
+            );
         Parallel::barrier(_comm);  // ensure .pvti file is written before returning
     }
 
@@ -104,7 +103,7 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
                         .as_piece_for(std::move(domain))
                         .with_offset(offset);
         this->copy_fields(writer);
-        writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
+        this->_write_nested(writer, PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
 
     void _write_pvti_file(const std::string& filename_with_ext,
@@ -112,8 +111,6 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
                           const std::array<std::size_t, dim>& extents,
                           const std::vector<std::array<std::size_t, dim>>& proc_extents_begin,
                           const std::vector<std::array<std::size_t, dim>>& proc_extents_end) const {
-        std::ofstream file_stream(filename_with_ext, std::ios::out);
-
         XMLElement pvtk_xml("VTKFile");
         pvtk_xml.set_attribute("type", "PImageData");
 
@@ -154,7 +151,9 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
         });
 
         this->_set_default_active_fields(pvtk_xml.get_child("PImageData"));
-        write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        this->_write_output(filename_with_ext, [&] (std::ostream& file_stream) {
+            write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        });
     }
 };
 
@@ -10,7 +10,6 @@
 
 #include <ostream>
 #include <string>
-#include <fstream>
 #include <filesystem>
 
 #include <gridformat/common/exceptions.hpp>
@@ -56,7 +55,7 @@ class PVTPWriter : public VTK::XMLWriterBase<Grid, PVTPWriter<Grid, Communicator
     void _write(std::ostream&) const override {
         throw InvalidState(
             "PVTPWriter does not support direct export into stream. "
-            "Use overload with filename instead!"
+            "Use overload with filename (and optionally a sink) instead!"
         );
     }
 
@@ -71,12 +70,10 @@ class PVTPWriter : public VTK::XMLWriterBase<Grid, PVTPWriter<Grid, Communicator
     void _write_piece(const std::string& par_filename) const {
         VTPWriter writer{this->grid(), this->_xml_opts};
         this->copy_fields(writer);
-        writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
+        this->_write_nested(writer, PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
 
     void _write_pvtu_file(const std::string& filename_with_ext) const {
-        std::ofstream file_stream(filename_with_ext, std::ios::out);
-
         XMLElement pvtk_xml("VTKFile");
         pvtk_xml.set_attribute("type", "PPolyData");
 
@@ -109,7 +106,9 @@ class PVTPWriter : public VTK::XMLWriterBase<Grid, PVTPWriter<Grid, Communicator
         });
 
         this->_set_default_active_fields(pvtk_xml.get_child("PPolyData"));
-        write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        this->_write_output(filename_with_ext, [&] (std::ostream& file_stream) {
+            write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        });
     }
 };
 
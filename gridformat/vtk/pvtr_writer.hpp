@@ -10,7 +10,6 @@
 
 #include <ostream>
 #include <string>
-#include <fstream>
 #include <algorithm>
 #include <filesystem>
 #include <array>
@@ -43,7 +42,6 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
 
     static constexpr std::size_t space_dim = 3;
     static constexpr std::size_t dim = dimension<Grid>;
-    static constexpr int root_rank = 0;
 
  public:
     explicit PVTRWriter(LValueReferenceOf<const Grid> grid,
@@ -59,6 +57,7 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
 
  private:
     Communicator _comm;
+    mutable PVTK::StructuredGridDecompositionCache<CT, dim> _decomposition;
 
     PVTRWriter _with(VTK::XMLOptions xml_opts) const override {
         return PVTRWriter{this->grid(), _comm, std::move(xml_opts)};
@@ -67,7 +66,7 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
     void _write(std::ostream&) const override {
         throw InvalidState(
             "PVTRWriter does not support direct export into stream. "
-            "Use overload with filename instead!"
+            "Use overload with filename (and optionally a sink) instead!"
         );
     }
 
@@ -75,22 +74,26 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
         const auto& local_extents = extents(this->grid());
         const auto [origin, is_negative_axis] = _get_origin_and_orientations();
 
-        PVTK::StructuredParallelGridHelper helper{_comm};
-        const auto all_origins = Parallel::gather(_comm, origin, root_rank);
-        const auto all_extents = Parallel::gather(_comm, local_extents, root_rank);
-        const auto [exts_begin, exts_end, whole_extent, _] = helper.compute_extents_and_origin(
-            all_origins,
-            all_extents,
+        const auto& decomposition = _decomposition.get(
+            _comm,
+            origin,
+            Ranges::to_array<dim, std::size_t>(local_extents),
             is_negative_axis
         );
 
-        const auto my_whole_extent = Parallel::broadcast(_comm, whole_extent, root_rank);
-        const auto my_extent_offset = Parallel::scatter(_comm, Ranges::flat(exts_begin), root_rank);
-
-        _write_piece(filename_with_ext, Ranges::to_array<dim>(my_extent_offset), {my_whole_extent});
+        _write_piece(
+            filename_with_ext,
+            decomposition.pieces_begin.at(Parallel::rank(_comm)),
+            {decomposition.whole_extent}
+        );
         Parallel::barrier(_comm);  // ensure all pieces finished successfully
         if (Parallel::rank(_comm) == 0)
-            _write_pvtr_file(filename_with_ext, my_whole_extent, exts_begin, exts_end);
+            _write_pvtr_file(
+                filename_with_ext,
+                decomposition.whole_extent,
+                decomposition.pieces_begin,
+                decomposition.pieces_end
+            );
         Parallel::barrier(_comm);  // ensure .pvtr file is written before returning
     }
 
@@ -114,15 +117,13 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
                         .as_piece_for(std::move(domain))
                         .with_offset(offset);
         this->copy_fields(writer);
-        writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
+        this->_write_nested(writer, PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
 
     void _write_pvtr_file(const std::string& filename_with_ext,
                           const std::array<std::size_t, dim>& extents,
                           const std::vector<std::array<std::size_t, dim>>& proc_extents_begin,
                           const std::vector<std::array<std::size_t, dim>>& proc_extents_end) const {
-        std::ofstream file_stream(filename_with_ext, std::ios::out);
-
         XMLElement pvtk_xml("VTKFile");
         pvtk_xml.set_attribute("type", "PRectilinearGrid");
 
@@ -170,7 +171,9 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
         });
 
         this->_set_default_active_fields(pvtk_xml.get_child("PRectilinearGrid"));
-        write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        this->_write_output(filename_with_ext, [&] (std::ostream& file_stream) {
+            write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        });
     }
 };
 
@@ -10,24 +10,176 @@
 
 #include <ostream>
 #include <string>
-#include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <span>
 
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/lvalue_reference.hpp>
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/common/lazy_field.hpp>
+#include <gridformat/common/md_layout.hpp>
 #include <gridformat/parallel/communication.hpp>
+#include <gridformat/parallel/concepts.hpp>
 #include <gridformat/parallel/helpers.hpp>
 
 #include <gridformat/grid/grid.hpp>
+#include <gridformat/grid/traits.hpp>
 #include <gridformat/xml/element.hpp>
+#include <gridformat/vtk/common.hpp>
 #include <gridformat/vtk/vtu_writer.hpp>
 #include <gridformat/vtk/parallel.hpp>
 
 namespace GridFormat {
 
+#ifndef DOXYGEN
+namespace PVTUDetail {
+
+    //! Unstructured grid (and fields) assembled from the serialized pieces of several ranks
+    struct AggregatedPiece {
+        Serialization coordinates;   // three doubles per point
+        Serialization connectivity;  // std::size_t
+        Serialization offsets;       // std::size_t
+        Serialization types;         // vtk cell type ids (std::uint8_t)
+        std::vector<Serialization> point_fields;
+        std::vector<Serialization> cell_fields;
+
+        std::size_t number_of_points() const { return coordinates.size()/(3*sizeof(double)); }
+        std::size_t number_of_cells() const { return types.size()/sizeof(std::uint8_t); }
+
+        std::span<const double> coordinates_span() const { return coordinates.as_span_of<double>(); }
+        std::span<const std::size_t> connectivity_span() const { return connectivity.as_span_of<std::size_t>(); }
+        std::span<const std::size_t> offsets_span() const { return offsets.as_span_of<std::size_t>(); }
+
+        //! Return all buffers in the order in which they are communicated
+        std::vector<Serialization*> buffers() {
+            std::vector<Serialization*> result{&coordinates, &connectivity, &offsets, &types};
+            std::ranges::for_each(point_fields, [&] (Serialization& s) { result.push_back(&s); });
+            std::ranges::for_each(cell_fields, [&] (Serialization& s) { result.push_back(&s); });
+            return result;
+        }
+
+        //! Append the given piece, shifting its point and connectivity indices accordingly
+        void append(AggregatedPiece&& other) {
+            if (other.point_fields.size() != point_fields.size() || other.cell_fields.size() != cell_fields.size())
+                throw SizeError("Pieces to be aggregated have differing numbers of fields");
+
+            const std::size_t point_offset = number_of_points();
+            const std::size_t connectivity_offset = connectivity.size()/sizeof(std::size_t);
+            std::ranges::for_each(other.connectivity.as_span_of<std::size_t>(), [&] (std::size_t& i) { i += point_offset; });
+            std::ranges::for_each(other.offsets.as_span_of<std::size_t>(), [&] (std::size_t& o) { o += connectivity_offset; });
+
+            auto other_buffers = other.buffers();
+            auto my_buffers = buffers();
+            for (std::size_t i = 0; i < my_buffers.size(); ++i)
+                my_buffers[i]->push_back(std::move(*other_buffers[i]).data());
+        }
+    };
+
+}  // namespace PVTUDetail
+#endif  // DOXYGEN
+
+namespace Traits {
+
+template<>
+struct Points<PVTUDetail::AggregatedPiece> {
+    static std::ranges::range auto get(const PVTUDetail::AggregatedPiece& piece) {
+        return std::views::iota(std::size_t{0}, piece.number_of_points());
+    }
+};
+
+template<>
+struct Cells<PVTUDetail::AggregatedPiece> {
+    static std::ranges::range auto get(const PVTUDetail::AggregatedPiece& piece) {
+        return std::views::iota(std::int64_t{0}, static_cast<std::int64_t>(piece.number_of_cells()));
+    }
+};
+
+template<>
+struct NumberOfPoints<PVTUDetail::AggregatedPiece> {
+    static std::size_t get(const PVTUDetail::AggregatedPiece& piece) {
+        return piece.number_of_points();
+    }
+};
+
+template<>
+struct NumberOfCells<PVTUDetail::AggregatedPiece> {
+    static std::size_t get(const PVTUDetail::AggregatedPiece& piece) {
+        return piece.number_of_cells();
+    }
+};
+
+template<>
+struct CellPoints<PVTUDetail::AggregatedPiece, std::int64_t> {
+    static std::ranges::range auto get(const PVTUDetail::AggregatedPiece& piece, const std::int64_t i) {
+        const auto offsets = piece.offsets_span();
+        const std::size_t begin = i > 0 ? offsets[i - 1] : std::size_t{0};
+        return piece.connectivity_span().subspan(begin, offsets[i] - begin);
+    }
+};
+
+template<>
+struct CellType<PVTUDetail::AggregatedPiece, std::int64_t> {
+    static GridFormat::CellType get(const PVTUDetail::AggregatedPiece& piece, const std::int64_t i) {
+        return VTK::cell_type(piece.types.as_span_of<std::uint8_t>()[i]);
+    }
+};
+
+template<>
+struct PointCoordinates<PVTUDetail::AggregatedPiece, std::size_t> {
+    static std::array<double, 3> get(const PVTUDetail::AggregatedPiece& piece, const std::size_t i) {
+        const auto coords = piece.coordinates_span().subspan(i*3, 3);
+        return {coords[0], coords[1], coords[2]};
+    }
+};
+
+template<>
+struct PointId<PVTUDetail::AggregatedPiece, std::size_t> {
+    static std::size_t get(const PVTUDetail::AggregatedPiece&, const std::size_t i) {
+        return i;
+    }
+};
+
+template<>
+struct NumberOfCellPoints<PVTUDetail::AggregatedPiece, std::int64_t> {
+    static std::size_t get(const PVTUDetail::AggregatedPiece& piece, const std::int64_t i) {
+        return Ranges::size(CellPoints<PVTUDetail::AggregatedPiece, std::int64_t>::get(piece, i));
+    }
+};
+
+template<>
+struct Coordinates<PVTUDetail::AggregatedPiece> {
+    static std::span<const double> get(const PVTUDetail::AggregatedPiece& piece) {
+        return piece.coordinates_span();
+    }
+};
+
+template<>
+struct Connectivity<PVTUDetail::AggregatedPiece> {
+    static std::span<const std::size_t> get(const PVTUDetail::AggregatedPiece& piece) {
+        return piece.connectivity_span();
+    }
+};
+
+template<>
+struct Offsets<PVTUDetail::AggregatedPiece> {
+    static std::span<const std::size_t> get(const PVTUDetail::AggregatedPiece& piece) {
+        return piece.offsets_span();
+    }
+};
+
+}  // namespace Traits
+
 /*!
  * \ingroup VTK
  * \brief Writer for parallel .pvtu files
+ * \note Per default, each rank writes its own piece file. Using PVTK::PieceAggregation, the pieces of
+ *       groups of consecutive ranks can be sent to the first rank of each group, which merges them into
+ *       a single piece file. This requires a communicator supporting point-to-point communication.
  */
 template<Concepts::UnstructuredGrid Grid,
          Concepts::Communicator Communicator>
@@ -37,10 +189,14 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
  public:
     explicit PVTUWriter(LValueReferenceOf<const Grid> grid,
                         Communicator comm,
-                        VTK::XMLOptions xml_opts = {})
+                        VTK::XMLOptions xml_opts = {},
+                        PVTK::PieceAggregation aggregation = {})
     : ParentType(grid.get(), ".pvtu", false, xml_opts)
     , _comm(comm)
-    {}
+    , _aggregation{aggregation} {
+        if (_aggregation.ranks_per_file == 0)
+            throw ValueError("Number of ranks per piece file must be positive");
+    }
 
     const Communicator& communicator() const {
         return _comm;
@@ -48,20 +204,24 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
 
  private:
     Communicator _comm;
+    PVTK::PieceAggregation _aggregation;
 
     PVTUWriter _with(VTK::XMLOptions xml_opts) const override {
-        return PVTUWriter{this->grid(), _comm, std::move(xml_opts)};
+        return PVTUWriter{this->grid(), _comm, std::move(xml_opts), _aggregation};
     }
 
     void _write(std::ostream&) const override {
         throw InvalidState(
             "PVTUWriter does not support direct export into stream. "
-            "Use overload with filename instead!"
+            "Use overload with filename (and optionally a sink) instead!"
         );
     }
 
     virtual void _write(const std::string& filename_with_ext) const override {
-        _write_piece(filename_with_ext);
+        if (_aggregation.ranks_per_file > 1)
+            _write_aggregated_piece(filename_with_ext);
+        else
+            _write_piece(filename_with_ext);
         Parallel::barrier(_comm);  // ensure all pieces finished successfully
         if (Parallel::rank(_comm) == 0)
             _write_pvtu_file(filename_with_ext);
@@ -71,12 +231,103 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
     void _write_piece(const std::string& par_filename) const {
         VTUWriter writer{this->grid(), this->_xml_opts};
         this->copy_fields(writer);
-        writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
+        this->_write_nested(writer, PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
 
-    void _write_pvtu_file(const std::string& filename_with_ext) const {
-        std::ofstream file_stream(filename_with_ext, std::ios::out);
+    void _write_aggregated_piece(const std::string& par_filename) const {
+        if constexpr (Concepts::PointToPointCommunicator<Communicator>) {
+            const int rank = Parallel::rank(_comm);
+            const int group_size = static_cast<int>(_aggregation.ranks_per_file);
+            const int aggregator = rank - rank%group_size;
+
+            PVTUDetail::AggregatedPiece piece = _make_aggregated_piece();
+            if (rank != aggregator) {
+                std::ranges::for_each(piece.buffers(), [&] (const Serialization* buffer) {
+                    Parallel::send(_comm, buffer->as_span(), aggregator);
+                });
+                return;
+            }
+
+            const int group_end = std::min(aggregator + group_size, Parallel::size(_comm));
+            for (int source = aggregator + 1; source < group_end; ++source) {
+                PVTUDetail::AggregatedPiece other = _make_empty_piece();
+                std::ranges::for_each(other.buffers(), [&] (Serialization* buffer) {
+                    buffer->push_back(Parallel::receive<std::byte>(_comm, source));
+                });
+                piece.append(std::move(other));
+            }
+            _write_aggregated_piece_file(piece, PVTK::piece_basefilename(par_filename, aggregator/group_size));
+        } else {
+            if (Parallel::size(_comm) > 1)
+                throw NotImplemented("Piece aggregation requires a communicator supporting point-to-point communication");
+            _write_piece(par_filename);
+        }
+    }
 
+    PVTUDetail::AggregatedPiece _make_empty_piece() const {
+        PVTUDetail::AggregatedPiece piece;
+        piece.point_fields.resize(Ranges::size(this->_point_field_names()));
+        piece.cell_fields.resize(Ranges::size(this->_cell_field_names()));
+        return piece;
+    }
+
+    PVTUDetail::AggregatedPiece _make_aggregated_piece() const {
+        const auto point_id_map = VTK::make_connectivity_point_id_map(this->grid());
+        const auto topology = VTK::make_topology_fields<std::size_t>(this->grid(), point_id_map);
+        PVTUDetail::AggregatedPiece piece{
+            .coordinates = VTK::make_coordinates_field<double>(this->grid(), false)->serialized(),
+            .connectivity = topology.connectivity->serialized(),
+            .offsets = topology.offsets->serialized(),
+            .types = topology.types->serialized(),
+            .point_fields = {},
+            .cell_fields = {}
+        };
+        std::ranges::for_each(this->_point_field_names(), [&] (const std::string& name) {
+            piece.point_fields.push_back(VTK::make_vtk_field(this->_get_point_field_ptr(name))->serialized());
+        });
+        std::ranges::for_each(this->_cell_field_names(), [&] (const std::string& name) {
+            piece.cell_fields.push_back(VTK::make_vtk_field(this->_get_cell_field_ptr(name))->serialized());
+        });
+        return piece;
+    }
+
+    void _write_aggregated_piece_file(PVTUDetail::AggregatedPiece& piece, const std::string& filename) const {
+        // the field layouts and precisions are the same on all ranks, only the number of entities differs
+        const auto make_merged_field = [] (FieldPtr field, std::size_t num_entities, Serialization& values) {
+            const MDLayout layout = field->layout();
+            std::vector<std::size_t> extents(layout.begin(), layout.end());
+            extents.at(0) = num_entities;
+            return make_field_ptr(LazyField{
+                int{},  // dummy "source"
+                MDLayout{std::move(extents)},
+                field->precision(),
+                [&values] (const int&) { return values; }
+            });
+        };
+
+        VTUWriter writer{piece, this->_xml_opts};
+        for (const auto& [name, field_ptr] : meta_data_fields(*this))
+            writer.set_meta_data(name, field_ptr);
+
+        std::size_t i = 0;
+        std::ranges::for_each(this->_point_field_names(), [&] (const std::string& name) {
+            const FieldPtr field = VTK::make_vtk_field(this->_get_point_field_ptr(name));
+            writer.set_point_field(name, make_merged_field(field, piece.number_of_points(), piece.point_fields.at(i++)));
+        });
+        i = 0;
+        std::ranges::for_each(this->_cell_field_names(), [&] (const std::string& name) {
+            const FieldPtr field = VTK::make_vtk_field(this->_get_cell_field_ptr(name));
+            writer.set_cell_field(name, make_merged_field(field, piece.number_of_cells(), piece.cell_fields.at(i++)));
+        });
+        this->_write_nested(writer, filename);
+    }
+
+    int _number_of_piece_files() const {
+        const int group_size = static_cast<int>(_aggregation.ranks_per_file);
+        return (Parallel::size(_comm) + group_size - 1)/group_size;
+    }
+
+    void _write_pvtu_file(const std::string& filename_with_ext) const {
         XMLElement pvtk_xml("VTKFile");
         pvtk_xml.set_attribute("type", "PUnstructuredGrid");
 
@@ -102,20 +353,25 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
             point_array.set_attribute("type", VTK::attribute_name(prec));
         }, this->_xml_settings.coordinate_precision);
 
-        std::ranges::for_each(Parallel::ranks(_comm), [&] (int rank) {
+        std::ranges::for_each(std::views::iota(0, _number_of_piece_files()), [&] (int piece) {
             grid.add_child("Piece").set_attribute("Source", std::filesystem::path{
-                PVTK::piece_basefilename(filename_with_ext, rank) + ".vtu"
+                PVTK::piece_basefilename(filename_with_ext, piece) + ".vtu"
             }.filename());
         });
 
         this->_set_default_active_fields(pvtk_xml.get_child("PUnstructuredGrid"));
-        write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        this->_write_output(filename_with_ext, [&] (std::ostream& file_stream) {
+            write_xml_with_version_header(pvtk_xml, file_stream, Indentation{{.width = 2}});
+        });
     }
 };
 
 template<typename G, Concepts::Communicator C>
 PVTUWriter(G&&, const C&, VTK::XMLOptions = {}) -> PVTUWriter<std::remove_cvref_t<G>, C>;
 
+template<typename G, Concepts::Communicator C>
+PVTUWriter(G&&, const C&, VTK::XMLOptions, PVTK::PieceAggregation) -> PVTUWriter<std::remove_cvref_t<G>, C>;
+
 }  // namespace GridFormat
 
 #endif  // GRIDFORMAT_VTK_PVTU_WRITER_HPP_
@@ -149,6 +149,22 @@ class VTRReader : public GridReader {
         return _helper.value().make_data_array_field(name, "RectilinearGrid/Piece/PointData", _number_of_points());
     }
 
+    FieldPtr _cell_field_in_region(std::string_view name,
+                                   const typename GridReader::PieceLocation& region) const override {
+        return _helper.value().make_data_array_field(
+            name, "RectilinearGrid/Piece/CellData", _number_of_cells(),
+            GridReaderDetail::select_structured(_location(), region, false).runs()
+        );
+    }
+
+    FieldPtr _point_field_in_region(std::string_view name,
+                                    const typename GridReader::PieceLocation& region) const override {
+        return _helper.value().make_data_array_field(
+            name, "RectilinearGrid/Piece/PointData", _number_of_points(),
+            GridReaderDetail::select_structured(_location(), region, true).runs()
+        );
+    }
+
     FieldPtr _meta_data_field(std::string_view name) const override {
         return _helper.value().make_data_array_field(name, "RectilinearGrid/FieldData");
     }
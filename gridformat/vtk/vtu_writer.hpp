@@ -57,21 +57,17 @@ class VTUWriter : public VTK::XMLWriterBase<Grid, VTUWriter<Grid>> {
             this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
         });
 
-        const auto point_id_map = make_point_id_map(this->grid());
+        const auto point_id_map = VTK::make_connectivity_point_id_map(this->grid());
         const FieldPtr coords_field = std::visit([&] <typename T> (const Precision<T>&) {
             return VTK::make_coordinates_field<T>(this->grid(), false);
         }, this->_xml_settings.coordinate_precision);
-        const FieldPtr connectivity_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_connectivity_field<T>(this->grid(), point_id_map);
+        const VTK::TopologyFields topology = std::visit([&] <typename T> (const Precision<T>&) {
+            return VTK::make_topology_fields<T>(this->grid(), point_id_map);
         }, this->_xml_settings.header_precision);
-        const FieldPtr offsets_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_offsets_field<T>(this->grid());
-        }, this->_xml_settings.header_precision);
-        const FieldPtr types_field = VTK::make_cell_types_field(this->grid());
         this->_set_data_array(context, "Piece/Points", "Coordinates", *coords_field);
-        this->_set_data_array(context, "Piece/Cells", "connectivity", *connectivity_field);
-        this->_set_data_array(context, "Piece/Cells", "offsets", *offsets_field);
-        this->_set_data_array(context, "Piece/Cells", "types", *types_field);
+        this->_set_data_array(context, "Piece/Cells", "connectivity", *topology.connectivity);
+        this->_set_data_array(context, "Piece/Cells", "offsets", *topology.offsets);
+        this->_set_data_array(context, "Piece/Cells", "types", *topology.types);
         this->_write_xml(std::move(context), s);
     }
 };
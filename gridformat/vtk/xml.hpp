@@ -9,6 +9,14 @@
 #define GRIDFORMAT_VTK_XML_HPP_
 
 #include <bit>
+#include <array>
+#include <fstream>
+#include <span>
+#include <vector>
+#include <numeric>
+#include <charconv>
+#include <algorithm>
+#include <system_error>
 #include <string>
 #include <ranges>
 #include <utility>
@@ -30,6 +38,7 @@
 #include <gridformat/common/field.hpp>
 #include <gridformat/common/lazy_field.hpp>
 #include <gridformat/common/path.hpp>
+#include <gridformat/common/concurrency.hpp>
 
 #include <gridformat/encoding/base64.hpp>
 #include <gridformat/encoding/ascii.hpp>
@@ -38,6 +47,9 @@
 #include <gridformat/compression/lz4.hpp>
 #include <gridformat/compression/lzma.hpp>
 #include <gridformat/compression/zlib.hpp>
+#include <gridformat/compression/zstd.hpp>
+#include <gridformat/compression/pre_filter.hpp>
+#include <gridformat/compression/adaptive.hpp>
 
 #include <gridformat/grid/concepts.hpp>
 #include <gridformat/grid/writer.hpp>
@@ -58,7 +70,23 @@ namespace XMLDetail {
     using LZMACompressor = std::conditional_t<Compression::Detail::_have_lzma, Compression::LZMA, None>;
     using ZLIBCompressor = std::conditional_t<Compression::Detail::_have_zlib, Compression::ZLIB, None>;
     using LZ4Compressor = std::conditional_t<Compression::Detail::_have_lz4, Compression::LZ4, None>;
-    using Compressor = UniqueVariant<LZ4Compressor, ZLIBCompressor, LZMACompressor>;
+    using ZSTDCompressor = std::conditional_t<Compression::Detail::_have_zstd, Compression::ZSTD, None>;
+    using Compressor = UniqueVariant<
+        LZ4Compressor, ZLIBCompressor, LZMACompressor, ZSTDCompressor, Compression::Adaptive
+    >;
+
+    // name of the first available candidate, used as file-level compressor with adaptive compression
+    inline std::string default_compressor_name(const Compression::Adaptive& adaptive) {
+        for (const auto& candidate : adaptive.candidates()) {
+            std::string name = std::visit([] <typename C> (const C& c) -> std::string {
+                if constexpr (is_none<C>) return "";
+                else return attribute_name(c);
+            }, candidate);
+            if (!name.empty())
+                return name;
+        }
+        return "";
+    }
 }  // namespace XMLDetail
 
 namespace XML {
@@ -86,15 +114,25 @@ using DefaultCompressor = std::variant_alternative_t<0, XMLDetail::Compressor>;
  *          - GridFormat::Encoding::raw
  *
  *          Note, however, that ascii encoding only works with inlined data, and raw binary encoding only
- *          works with appended data. Finally, one can choose between three different compressors or
+ *          works with appended data. Finally, one can choose between four different compressors or
  *          GridFormat::none:
  *          - GridFormat::Compression::zlib
  *          - GridFormat::Compression::lz4
  *          - GridFormat::Compression::lzma
+ *          - GridFormat::Compression::zstd
  *
  *          Note that these compressors are only available if the respective libraries were found.
+ *          Moreover, files compressed with zstd can be read by GridFormat, but not (yet) by VTK.
+ *          With GridFormat::Compression::adaptive, the compressor is chosen per data array (see
+ *          Compression::Adaptive), and the choice is stored in a custom attribute of the data arrays.
+ *          Such files are only guaranteed to be readable by GridFormat.
  *          All options can also be set to GridFormat::automatic, in which case a suitable option
  *          is chosen.
+ *
+ *          For compressed output, a reversible pre-filter (byte/bit shuffling and/or delta encoding
+ *          of integral arrays) can be chosen, which often improves the compression ratio significantly.
+ *          The filter is stored in a custom attribute of the data arrays, such that the resulting files
+ *          can be read by GridFormat, but not by VTK.
  */
 struct XMLOptions {
     using EncoderOption = ExtendedVariant<XML::Encoder, Automatic>;
@@ -106,6 +144,7 @@ struct XMLOptions {
     DataFormatOption data_format = automatic;
     CoordinatePrecisionOption coordinate_precision = automatic;
     XML::HeaderPrecision header_precision = _from_size_t();
+    Compression::PreFilter pre_filter = {};
 
  private:
     static constexpr XML::HeaderPrecision _from_size_t() {
@@ -124,6 +163,7 @@ namespace XMLDetail {
         XML::DataFormat data_format;
         XML::CoordinatePrecision coordinate_precision;
         XML::HeaderPrecision header_precision;
+        Compression::PreFilter pre_filter;
 
         template<typename GridCoordinateType>
         static XMLSettings from(const XMLOptions& opts) {
@@ -142,10 +182,16 @@ namespace XMLDetail {
                     Variant::is<Automatic>(opts.coordinate_precision) ?
                         XML::CoordinatePrecision{Precision<GridCoordinateType>{}} :
                         Variant::without<Automatic>(opts.coordinate_precision),
-                .header_precision = opts.header_precision
+                .header_precision = opts.header_precision,
+                .pre_filter = _make_pre_filter(_comp, opts.pre_filter)
             };
         }
 
+        //! Return the filter to be used for a data array with the given precision
+        Compression::PreFilter pre_filter_for(const DynamicPrecision& prec) const {
+            return pre_filter.for_precision(prec);
+        }
+
      private:
         static XML::Encoder _make_encoder(const typename XMLOptions::EncoderOption& enc) {
             if (Variant::is<Automatic>(enc))
@@ -174,6 +220,15 @@ namespace XMLDetail {
             }
             return Variant::without<Automatic>(compressor);
         }
+
+        static Compression::PreFilter _make_pre_filter(const typename XML::Compressor& compressor,
+                                                       const Compression::PreFilter& filter) {
+            if (Variant::is<None>(compressor) && !filter.is_identity()) {
+                log_warning("Pre-filters are only applied to compressed output. Ignoring chosen filter...");
+                return {};
+            }
+            return filter;
+        }
     };
 
 }  // namespace XMLDetail
@@ -247,6 +302,12 @@ class XMLWriterBase
         return with(std::move(opts));
     }
 
+    Impl with_pre_filter(const Compression::PreFilter& filter) const {
+        auto opts = _xml_opts;
+        opts.pre_filter = filter;
+        return with(std::move(opts));
+    }
+
  private:
     virtual Impl _with(XMLOptions opts) const = 0;
 
@@ -268,8 +329,13 @@ class XMLWriterBase
                 xml.set_attribute("version", "2.2");
                 xml.set_attribute("byte_order", attribute_name(std::endian::native));
                 xml.set_attribute("header_type", attribute_name(DynamicPrecision{header_precision}));
-                if constexpr (!is_none<decltype(compressor)>)
+                using C = std::remove_cvref_t<decltype(compressor)>;
+                if constexpr (std::is_same_v<C, Compression::Adaptive>) {
+                    if (const auto name = XMLDetail::default_compressor_name(compressor); !name.empty())
+                        xml.set_attribute("compressor", name);
+                } else if constexpr (!is_none<C>) {
                     xml.set_attribute("compressor", attribute_name(compressor));
+                }
                 xml.add_child(vtk_grid_type);
 
                 WriteContext context{
@@ -316,7 +382,9 @@ class XMLWriterBase
                                         : 1
                                 );
                             }
-                            DataArray content{field, encoder, compressor, header_precision};
+                            const auto filter = _set_pre_filter_attribute(array, precision);
+                            DataArray content{field, encoder, compressor, header_precision, filter};
+                            _set_selected_compressor_attribute(array, content);
                             _set_data_array_content(data_format, array, context.appendix, std::move(content));
                         });
                     }, _xml_settings.header_precision);
@@ -347,7 +415,9 @@ class XMLWriterBase
                 std::visit([&] (const auto& data_format) {
                     std::visit([&] (const auto& header_prec) {
                         da.set_attribute("format", data_format_name(encoder, data_format));
-                        DataArray content{field, encoder, compressor, header_prec};
+                        const auto filter = _set_pre_filter_attribute(da, field.precision());
+                        DataArray content{field, encoder, compressor, header_prec, filter};
+                        _set_selected_compressor_attribute(da, content);
                         _set_data_array_content(data_format, da, context.appendix, std::move(content));
                     }, _xml_settings.header_precision);
                 }, _xml_settings.data_format);
@@ -355,6 +425,23 @@ class XMLWriterBase
         }, _xml_settings.encoder);
     }
 
+    Compression::PreFilter _set_pre_filter_attribute(XMLElement& data_array, const DynamicPrecision& prec) const {
+        const auto filter = _xml_settings.pre_filter_for(prec);
+        if (!filter.is_identity())
+            data_array.set_attribute("GridFormatPreFilter", Compression::as_string(filter));
+        return filter;
+    }
+
+    template<typename Content>
+    void _set_selected_compressor_attribute(XMLElement& data_array, const Content& content) const {
+        if constexpr (requires { content.selected_compressor(); }) {
+            const auto name = content.selected_compressor();
+            data_array.set_attribute("GridFormatCompressor", name.empty() ? "none" : name);
+            if (name.empty())  // pre-filters are only applied to compressed arrays
+                data_array.remove_attribute("GridFormatPreFilter");
+        }
+    }
+
     template<typename DataFormat, typename Appendix, typename Content>
         requires(!std::is_lvalue_reference_v<Content>)
     void _set_data_array_content(const DataFormat&,
@@ -450,6 +537,164 @@ namespace XMLDetail {
         }
     }
 
+    // Read the binary data array with the given (decoded) header, beginning at the given position, as stored
+    // in the stream. Base64-encoded headers & values are either encoded separately or together (without padding).
+    template<std::integral HeaderType>
+    Serialization read_data_array_payload(std::istream& s,
+                                          std::streampos begin,
+                                          const std::vector<HeaderType>& header,
+                                          bool is_compressed,
+                                          bool is_base64) {
+        if (header.empty() || (is_compressed && (header.size() < 3 || header.size() != 3 + static_cast<std::size_t>(header[0]))))
+            throw SizeError("Unexpected data array header");
+
+        const std::size_t header_bytes = sizeof(HeaderType)*header.size();
+        const std::size_t value_bytes = is_compressed
+            ? std::accumulate(header.begin() + 3, header.end(), std::size_t{0})
+            : static_cast<std::size_t>(header[0]);
+        std::size_t size = header_bytes + value_bytes;
+        if (is_base64) {
+            std::string header_chars(Base64::encoded_size(header_bytes), '\0');
+            s.seekg(begin);
+            s.read(header_chars.data(), static_cast<std::streamsize>(header_chars.size()));
+            size = header_chars.find('=') != std::string::npos
+                ? Base64::encoded_size(header_bytes) + Base64::encoded_size(value_bytes)
+                : Base64::encoded_size(header_bytes + value_bytes);
+        }
+
+        Serialization result{size};
+        auto chars = result.template as_span_of<char>();
+        s.seekg(begin);
+        s.read(chars.data(), static_cast<std::streamsize>(chars.size()));
+        if (static_cast<std::size_t>(s.gcount()) != size)
+            throw IOError("Could not read the data array payload from the stream");
+        return result;
+    }
+
+    // minimum number of characters of ascii data parsed per thread
+    inline constexpr std::size_t min_ascii_chars_per_thread = 1 << 20;
+
+    inline bool _is_ascii_whitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    inline std::size_t _count_ascii_values(std::string_view chars) {
+        std::size_t count = 0;
+        bool is_in_value = false;
+        for (const char c : chars) {
+            const bool is_whitespace = _is_ascii_whitespace(c);
+            if (!is_whitespace && !is_in_value)
+                ++count;
+            is_in_value = !is_whitespace;
+        }
+        return count;
+    }
+
+    // split the given characters into (at most) n chunks at whitespace positions
+    inline std::vector<std::string_view> _split_ascii_chunks(std::string_view chars, std::size_t n) {
+        std::vector<std::string_view> chunks;
+        chunks.reserve(n);
+        std::size_t chunk_begin = 0;
+        for (std::size_t i = 1; i <= n && chunk_begin < chars.size(); ++i) {
+            std::size_t chunk_end = i == n ? chars.size() : std::max(chunk_begin, i*chars.size()/n);
+            while (chunk_end < chars.size() && !_is_ascii_whitespace(chars[chunk_end]))
+                ++chunk_end;
+            chunks.push_back(chars.substr(chunk_begin, chunk_end - chunk_begin));
+            chunk_begin = chunk_end;
+        }
+        return chunks;
+    }
+
+    // parse the whitespace-separated values in the given characters into the given
+    // buffer until it is full, and return the number of values that were parsed
+    template<Concepts::Scalar T>
+    std::size_t _parse_ascii_values(std::string_view chars, std::span<T> out) {
+        // from_chars for small integral types would reject values that are out of range,
+        // while with the stream-based reading used previously, these were narrowed
+        using ParsedType = std::conditional_t<
+            std::integral<T> && sizeof(T) < sizeof(short),
+            std::conditional_t<std::signed_integral<T>, short, unsigned short>,
+            T
+        >;
+
+        const char* it = chars.data();
+        const char* end = chars.data() + chars.size();
+        std::size_t count = 0;
+        while (count < out.size()) {
+            while (it != end && _is_ascii_whitespace(*it))
+                ++it;
+            if (it == end)
+                break;
+            if (*it == '+')  // not accepted by std::from_chars
+                ++it;
+
+            ParsedType value;
+            const auto [ptr, ec] = std::from_chars(it, end, value);
+            if (ec != std::errc{} || (ptr != end && !_is_ascii_whitespace(*ptr)))
+                throw IOError("A read value could not be converted to type: " + std::string{typeid(T).name()});
+            out[count++] = static_cast<T>(value);
+            it = ptr;
+        }
+        return count;
+    }
+
+    // parse ascii values into the given buffer, using multiple threads for large inputs
+    template<Concepts::Scalar T>
+    void _read_ascii_values(std::string_view chars, std::span<T> out, std::size_t num_threads) {
+        if (num_threads <= 1) {
+            if (_parse_ascii_values(chars, out) < out.size())
+                throw SizeError("Could not read the requested number of values from the stream");
+            return;
+        }
+
+        const auto chunks = _split_ascii_chunks(chars, num_threads);
+        std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+        run_concurrently(chunks.size(), [&] (std::size_t i) {
+            offsets[i + 1] = _count_ascii_values(chunks[i]);
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        if (offsets.back() < out.size())
+            throw SizeError("Could not read the requested number of values from the stream");
+
+        run_concurrently(chunks.size(), [&] (std::size_t i) {
+            if (offsets[i] < out.size()) {
+                const std::size_t count = std::min(offsets[i + 1], out.size()) - offsets[i];
+                _parse_ascii_values(chunks[i], out.subspan(offsets[i], count));
+            }
+        });
+    }
+
+    template<Concepts::Scalar T>
+    void _read_ascii_values(std::string_view chars, std::span<T> out) {
+        _read_ascii_values(chars, out, std::min(hardware_concurrency(), chars.size()/min_ascii_chars_per_thread));
+    }
+
+    // total number of bytes in the given ranges {first, count}, which must not exceed the given size
+    inline std::size_t _total_size_of(std::span<const std::array<std::size_t, 2>> byte_ranges,
+                                      std::size_t number_of_bytes) {
+        std::size_t result = 0;
+        for (const auto& [first, count] : byte_ranges) {
+            if (first + count > number_of_bytes)
+                throw SizeError(
+                    "Requested bytes [" + std::to_string(first) + ", " + std::to_string(first + count) + ") "
+                    + "exceed the size of the data array (" + std::to_string(number_of_bytes) + ")"
+                );
+            result += count;
+        }
+        return result;
+    }
+
+    inline void _copy_byte_ranges(const Serialization& values,
+                                  std::span<const std::array<std::size_t, 2>> byte_ranges,
+                                  Serialization& out_values) {
+        out_values.resize(_total_size_of(byte_ranges, values.size()));
+        std::size_t out_offset = 0;
+        for (const auto& [first, count] : byte_ranges) {
+            std::copy_n(values.as_span().begin() + first, count, out_values.as_span().begin() + out_offset);
+            out_offset += count;
+        }
+    }
+
     template<typename HeaderType>
     void _decompress_with(const std::string& vtk_compressor,
                          [[maybe_unused]] Serialization& data,
@@ -471,6 +716,12 @@ namespace XMLDetail {
             ZLIBCompressor{}.decompress(data, blocks);
 #else
             throw InvalidState("Need ZLib to decompress the data");
+#endif
+        } else if (vtk_compressor == "vtkZstdDataCompressor") {
+#if GRIDFORMAT_HAVE_ZSTD
+            ZSTDCompressor{}.decompress(data, blocks);
+#else
+            throw InvalidState("Need ZSTD to decompress the data");
 #endif
         } else {
             throw NotImplemented("Unsupported vtk compressor '" + vtk_compressor + "'");
@@ -491,28 +742,22 @@ namespace XMLDetail {
 
         DataArrayReader(std::istream& s,
                         std::endian e = std::endian::native,
-                        std::string compressor = "")
+                        std::string compressor = "",
+                        Compression::PreFilter pre_filter = {})
         : _stream{s}
         , _endian{e}
         , _compressor{compressor}
+        , _pre_filter{pre_filter}
         {}
 
-        void read_ascii(std::size_t number_of_values, Serialization& out_values) {
+        void read_ascii(std::size_t number_of_values, Serialization& out_values, std::size_t number_of_chars) {
+            std::string chars(number_of_chars, '\0');
+            _stream.read(chars.data(), static_cast<std::streamsize>(number_of_chars));
+            if (static_cast<std::size_t>(_stream.gcount()) != number_of_chars)
+                throw IOError("Could not read the ascii data array content from the stream");
+
             out_values.resize(number_of_values*sizeof(TargetType));
-            std::span<TargetType> out_span = out_values.as_span_of(target_precision);
-
-            // istream_view uses operator>>, which seems to do weird stuff for e.g. uint8_t.
-            // The smallest supported integral type seems to be short. In case we deal with
-            // small integral types, we first read into a vector and then cast into the desired type.
-            if constexpr (is_too_small_integral) {
-                std::vector<BufferedType> buffer(number_of_values);
-                _read_ascii_to(std::span{buffer}, number_of_values);
-                std::ranges::copy(buffer | std::views::transform([] <typename T> (const T& value) {
-                    return static_cast<TargetType>(value);
-                }), out_span.begin());
-            } else {
-                _read_ascii_to(out_span, number_of_values);
-            }
+            _read_ascii_values(std::string_view{chars}, out_values.as_span_of(target_precision));
         }
 
         template<Concepts::Decoder Decoder>
@@ -529,22 +774,46 @@ namespace XMLDetail {
             }
         }
 
-     private:
-        template<typename T, std::size_t size>
-        void _read_ascii_to(std::span<T, size> buffer, std::size_t expected_num_values) const {
-            const auto [_, out] = std::ranges::copy(
-                std::ranges::istream_view<T>{_stream}
-                | std::views::take(expected_num_values),
-                buffer.begin()
-            );
-            const auto number_of_values_read = std::ranges::distance(buffer.begin(), out);
-            if (number_of_values_read < 0 || static_cast<std::size_t>(number_of_values_read) < expected_num_values) {
-                if (_stream.fail())
-                    throw IOError("A read value could not be converted to type: " + std::string{typeid(TargetType).name()});
-                throw SizeError("Could not read the requested number of values from the stream");
+        /*!
+         * \brief Read only the given byte ranges {first, count} of the (decoded & decompressed) values.
+         * \details Only the parts of the encoded data overlapping the ranges are decoded, and for
+         *          compressed arrays, only the overlapping blocks are decompressed. Pre-filters
+         *          operate on the entire array, so filtered arrays are read entirely.
+         * \note The ranges must be sorted and must not overlap.
+         */
+        template<Concepts::Decoder Decoder>
+        void read_binary_ranges(const Decoder& decoder,
+                                std::span<const std::array<std::size_t, 2>> byte_ranges,
+                                Serialization& out_values) {
+            if constexpr (std::unsigned_integral<HeaderType> && sizeof(HeaderType) >= 4) {
+                if (!_pre_filter.is_identity()) {
+                    Serialization values;
+                    read_binary(decoder, {}, values);
+                    return _copy_byte_ranges(values, byte_ranges, out_values);
+                }
+                if (_compressor.empty())
+                    return _read_encoded_ranges(decoder, byte_ranges, out_values);
+                else
+                    return _read_encoded_compressed_ranges(decoder, byte_ranges, out_values);
+            } else {
+                throw IOError("Unsupported header type");
             }
         }
 
+     private:
+        struct CompressionHeader {
+            HeaderType number_of_blocks;
+            HeaderType full_block_size;
+            HeaderType residual_block_size;
+            std::vector<HeaderType> compressed_block_sizes;
+
+            HeaderType number_of_raw_bytes() const {
+                return residual_block_size > 0
+                    ? full_block_size*(number_of_blocks-1) + residual_block_size
+                    : full_block_size*number_of_blocks;
+            }
+        };
+
         template<typename Decoder>
         void _read_encoded(const Decoder& decoder,
                            OptionalReference<Header> out_header = {},
@@ -587,9 +856,7 @@ namespace XMLDetail {
         }
 
         template<typename Decoder>
-        void _read_encoded_compressed(const Decoder& decoder,
-                                      OptionalReference<Header> out_header = {},
-                                      OptionalReference<Serialization> out_values = {}) {
+        CompressionHeader _read_compression_header(const Decoder& decoder) {
             const auto begin_pos = _stream.tellg();
             const auto header_bytes = sizeof(HeaderType)*3;
             Serialization header = decoder.decode_from(_stream, header_bytes);
@@ -605,15 +872,15 @@ namespace XMLDetail {
                 throw SizeError("Could not read data array header");
 
             change_byte_order(header_data, {.from = _endian});
-            const auto number_of_blocks = header_data[0];
-            const auto full_block_size = header_data[1];
-            const auto residual_block_size = header_data[2];
-            const HeaderType number_of_raw_bytes = residual_block_size > 0
-                ? full_block_size*(number_of_blocks-1) + residual_block_size
-                : full_block_size*number_of_blocks;
+            CompressionHeader result{
+                .number_of_blocks = header_data[0],
+                .full_block_size = header_data[1],
+                .residual_block_size = header_data[2],
+                .compressed_block_sizes = std::vector<HeaderType>(header_data[0])
+            };
 
             Serialization block_sizes;
-            const std::size_t block_sizes_bytes = sizeof(HeaderType)*number_of_blocks;
+            const std::size_t block_sizes_bytes = sizeof(HeaderType)*result.number_of_blocks;
             if (decode_blocks_with_header) {
                 _stream.seekg(begin_pos);
                 block_sizes = decoder.decode_from(_stream, header_bytes + block_sizes_bytes);
@@ -622,37 +889,172 @@ namespace XMLDetail {
                 block_sizes = decoder.decode_from(_stream, block_sizes_bytes);
             }
 
-            std::vector<HeaderType> compressed_block_sizes(number_of_blocks);
             change_byte_order(block_sizes.as_span_of(header_precision), {.from = _endian});
             std::ranges::copy(
                 block_sizes.as_span_of(header_precision),
-                compressed_block_sizes.begin()
+                result.compressed_block_sizes.begin()
             );
+            return result;
+        }
 
+        template<typename Decoder>
+        void _read_encoded_compressed(const Decoder& decoder,
+                                      OptionalReference<Header> out_header = {},
+                                      OptionalReference<Serialization> out_values = {}) {
+            auto header = _read_compression_header(decoder);
             if (out_header) {
-                std::ranges::copy(header_data, std::back_inserter(out_header.unwrap()));
-                std::ranges::copy(compressed_block_sizes, std::back_inserter(out_header.unwrap()));
+                out_header.unwrap().push_back(header.number_of_blocks);
+                out_header.unwrap().push_back(header.full_block_size);
+                out_header.unwrap().push_back(header.residual_block_size);
+                std::ranges::copy(header.compressed_block_sizes, std::back_inserter(out_header.unwrap()));
             }
 
             if (out_values) {
                 Serialization& values = out_values.unwrap();
                 values = decoder.decode_from(_stream, std::accumulate(
-                    compressed_block_sizes.begin(),
-                    compressed_block_sizes.end(),
+                    header.compressed_block_sizes.begin(),
+                    header.compressed_block_sizes.end(),
                     HeaderType{0}
                 ));
 
                 _decompress_with(_compressor, values, Compression::CompressedBlocks{
-                    {number_of_raw_bytes, full_block_size},
-                    std::move(compressed_block_sizes)
+                    {header.number_of_raw_bytes(), header.full_block_size},
+                    std::move(header.compressed_block_sizes)
                 });
+
+                // shuffling operates on the bytes as stored, delta encoding on the values
+                Compression::unshuffle(_pre_filter.shuffle, values, sizeof(TargetType));
                 change_byte_order(values.as_span_of(target_precision), {.from = _endian});
+                if (_pre_filter.delta)
+                    Compression::delta_decode(values, sizeof(TargetType));
+            }
+        }
+
+        template<typename Decoder>
+        void _read_encoded_ranges(const Decoder& decoder,
+                                  std::span<const std::array<std::size_t, 2>> byte_ranges,
+                                  Serialization& out_values) {
+            const auto begin_pos = _stream.tellg();
+            Serialization header = decoder.decode_from(_stream, sizeof(HeaderType));
+            if (header.size() < sizeof(HeaderType))
+                throw SizeError("Could not read header");
+
+            // without padding, header & values are encoded together (see _read_encoded())
+            const bool is_encoded_with_header = header.size() != sizeof(HeaderType);
+            const auto values_pos = is_encoded_with_header ? begin_pos : _stream.tellg();
+            const std::size_t values_offset = is_encoded_with_header ? sizeof(HeaderType) : 0;
+
+            header.resize(sizeof(HeaderType));
+            change_byte_order(header.as_span_of(header_precision), {.from = _endian});
+            const std::size_t number_of_bytes = header.as_span_of(header_precision)[0];
+
+            out_values.resize(_total_size_of(byte_ranges, number_of_bytes));
+            std::size_t out_offset = 0;
+            for (const auto& [first, count] : byte_ranges) {
+                const auto bytes = _decode_range(decoder, values_pos, values_offset + first, count);
+                std::ranges::copy(bytes.as_span(), out_values.as_span().begin() + out_offset);
+                out_offset += count;
+            }
+            change_byte_order(out_values.as_span_of(target_precision), {.from = _endian});
+        }
+
+        template<typename Decoder>
+        void _read_encoded_compressed_ranges(const Decoder& decoder,
+                                             std::span<const std::array<std::size_t, 2>> byte_ranges,
+                                             Serialization& out_values) {
+            const auto header = _read_compression_header(decoder);
+            const auto values_pos = _stream.tellg();
+            const std::size_t block_size = header.full_block_size;
+            const std::size_t number_of_raw_bytes = header.number_of_raw_bytes();
+            if (header.number_of_blocks > 0 && block_size == 0)
+                throw SizeError("Invalid block size in data array header");
+            out_values.resize(_total_size_of(byte_ranges, number_of_raw_bytes));
+
+            std::vector<std::size_t> compressed_offsets(header.number_of_blocks + 1, 0);
+            std::partial_sum(
+                header.compressed_block_sizes.begin(),
+                header.compressed_block_sizes.end(),
+                compressed_offsets.begin() + 1
+            );
+
+            // ranges are sorted, so we can decompress the overlapped blocks in consecutive groups
+            std::size_t out_offset = 0;
+            std::size_t range_idx = 0;
+            while (range_idx < byte_ranges.size()) {
+                if (byte_ranges[range_idx][1] == 0) {
+                    ++range_idx;
+                    continue;
+                }
+
+                const std::size_t first_block = byte_ranges[range_idx][0]/block_size;
+                std::size_t end_block = first_block;
+                std::size_t end_range = range_idx;
+                for (; end_range < byte_ranges.size(); ++end_range) {
+                    const auto& [first, count] = byte_ranges[end_range];
+                    if (count == 0)
+                        continue;
+                    if (first/block_size > end_block)
+                        break;
+                    end_block = std::max(end_block, (first + count - 1)/block_size + 1);
+                }
+
+                Serialization values = _decode_range(
+                    decoder,
+                    values_pos,
+                    compressed_offsets[first_block],
+                    compressed_offsets[end_block] - compressed_offsets[first_block]
+                );
+                const std::size_t raw_begin = first_block*block_size;
+                const std::size_t raw_size = std::min(end_block*block_size, number_of_raw_bytes) - raw_begin;
+                _decompress_with(_compressor, values, Compression::CompressedBlocks{
+                    {static_cast<HeaderType>(raw_size), header.full_block_size},
+                    std::vector<HeaderType>(
+                        header.compressed_block_sizes.begin() + first_block,
+                        header.compressed_block_sizes.begin() + end_block
+                    )
+                });
+
+                for (; range_idx < end_range; ++range_idx) {
+                    const auto& [first, count] = byte_ranges[range_idx];
+                    if (count == 0)
+                        continue;
+                    std::copy_n(
+                        values.as_span().begin() + (first - raw_begin),
+                        count,
+                        out_values.as_span().begin() + out_offset
+                    );
+                    out_offset += count;
+                }
             }
+            change_byte_order(out_values.as_span_of(target_precision), {.from = _endian});
+        }
+
+        // decode the given number of bytes, beginning at the given byte offset of the data encoded from pos
+        template<typename Decoder>
+        Serialization _decode_range(const Decoder& decoder,
+                                    std::streampos pos,
+                                    std::size_t byte_offset,
+                                    std::size_t number_of_bytes) {
+            // base64 encodes groups of three bytes in four characters
+            static constexpr bool is_base64 = std::is_same_v<std::remove_cvref_t<Decoder>, Base64Decoder>;
+            static constexpr std::size_t bytes_per_group = is_base64 ? 3 : 1;
+            static constexpr std::size_t chars_per_group = is_base64 ? 4 : 1;
+
+            const std::size_t group = byte_offset/bytes_per_group;
+            const std::size_t skipped_bytes = byte_offset - group*bytes_per_group;
+            _stream.seekg(pos + static_cast<std::streamoff>(group*chars_per_group));
+            Serialization result = decoder.decode_from(_stream, skipped_bytes + number_of_bytes);
+            if (result.size() < skipped_bytes + number_of_bytes)
+                throw SizeError("Could not read the requested number of bytes from the stream");
+            result.cut_front(skipped_bytes);
+            result.resize(number_of_bytes);
+            return result;
         }
 
         std::istream& _stream;
         std::endian _endian;
         std::string _compressor;
+        Compression::PreFilter _pre_filter;
     };
 
 }  // namespace XMLDetail
@@ -696,6 +1098,66 @@ const XMLElement& get_data_array(std::string_view name, const XMLElement& sectio
     );
 }
 
+/*!
+ * \ingroup VTK
+ * \brief Return the value of the `type` attribute of the `<VTKFile>` element in the given file
+ *        (e.g. "UnstructuredGrid" or "PUnstructuredGrid"), or an empty optional if the file
+ *        does not start like a VTK-XML file.
+ * \details Only the first `max_bytes` of the file are inspected, such that readers can be chosen
+ *          without parsing the entire file.
+ */
+inline std::optional<std::string> probe_file_type(const std::string& filename, std::size_t max_bytes = 4096) {
+    std::ifstream file{filename, std::ios::binary};
+    if (!file)
+        return {};
+
+    std::string chars(max_bytes, '\0');
+    file.read(chars.data(), static_cast<std::streamsize>(max_bytes));
+    chars.resize(static_cast<std::size_t>(file.gcount()));
+
+    const auto tag_begin = chars.find("<VTKFile");
+    if (tag_begin == std::string::npos)
+        return {};
+    const auto tag_end = chars.find('>', tag_begin);
+    if (tag_end == std::string::npos)
+        return {};
+
+    const std::string_view tag{chars.data() + tag_begin, tag_end - tag_begin};
+    for (auto pos = tag.find("type"); pos != std::string_view::npos; pos = tag.find("type", pos + 1)) {
+        // skip attributes that only end with "type" (e.g. header_type)
+        if (!XMLDetail::_is_ascii_whitespace(tag[pos - 1]))
+            continue;
+        auto cur = pos + 4;
+        while (cur < tag.size() && XMLDetail::_is_ascii_whitespace(tag[cur])) ++cur;
+        if (cur >= tag.size() || tag[cur] != '=')
+            continue;
+        ++cur;
+        while (cur < tag.size() && XMLDetail::_is_ascii_whitespace(tag[cur])) ++cur;
+        if (cur >= tag.size() || (tag[cur] != '"' && tag[cur] != '\''))
+            return {};
+        const auto value_end = tag.find(tag[cur], cur + 1);
+        if (value_end == std::string_view::npos)
+            return {};
+        return std::string{tag.substr(cur + 1, value_end - cur - 1)};
+    }
+    return {};
+}
+
+/*!
+ * \ingroup VTK
+ * \brief Return true if the given VTK-XML file type denotes a parallel file (e.g. "PUnstructuredGrid").
+ */
+inline bool is_parallel_file_type(std::string_view type) {
+    if (!type.starts_with("P"))
+        return false;
+    const auto sequential = type.substr(1);
+    return sequential == "ImageData"
+        || sequential == "RectilinearGrid"
+        || sequential == "StructuredGrid"
+        || sequential == "PolyData"
+        || sequential == "UnstructuredGrid";
+}
+
 }  // namespace XML
 
 
@@ -815,6 +1277,43 @@ class XMLReaderHelper {
         return _make_data_array_field(element, _number_of_tuples(element));
     }
 
+    /*!
+     * \brief Returns a field which draws only the given (sorted & non-overlapping) runs of tuples
+     *        {first, count} of a data array with the given number of tuples from the file upon request.
+     * \details For binary data, only the encoded data and compressed blocks overlapping the runs are read.
+     */
+    FieldPtr make_data_array_field(std::string_view name,
+                                   std::string_view section_path,
+                                   std::size_t number_of_tuples,
+                                   const std::vector<std::array<std::size_t, 2>>& tuple_runs) const {
+        const XMLElement& element = XML::get_data_array(name, get(section_path));
+        if (!element.has_attribute("type"))
+            throw ValueError("DataArray element does not specify the data type (`type` attribute)");
+        if (!element.has_attribute("format"))
+            throw ValueError("Data array element does not specify its format (e.g. ascii/binary)");
+        if (element.get_attribute("format") == "appended" && !element.has_attribute("offset"))
+            throw ValueError("Data array element specifies to use appended data but does not specify offset");
+
+        std::size_t number_of_selected_tuples = 0;
+        for (const auto& [first, count] : tuple_runs) {
+            if (first + count > number_of_tuples)
+                throw ValueError("Requested tuples exceed the number of tuples (" + as_string(number_of_tuples) + ")");
+            number_of_selected_tuples += count;
+        }
+
+        const auto num_comps = element.get_attribute_or(std::size_t{1}, "NumberOfComponents");
+        const auto prec = from_precision_attribute(element.get_attribute("type"));
+        const auto tuple_size = num_comps*prec.size_in_bytes();
+        std::vector<std::array<std::size_t, 2>> byte_ranges;
+        std::ranges::transform(tuple_runs, std::back_inserter(byte_ranges), [&] (const auto& run) {
+            return std::array<std::size_t, 2>{run[0]*tuple_size, run[1]*tuple_size};
+        });
+
+        return element.get_attribute("format") == "ascii"
+            ? _make_ascii_data_array_field(element, number_of_tuples, number_of_selected_tuples, std::move(byte_ranges))
+            : _make_binary_data_array_field(element, number_of_selected_tuples, std::move(byte_ranges));
+    }
+
  private:
     const XMLElement& _element() const {
         return _parser.get_xml();
@@ -841,6 +1340,70 @@ class XMLReaderHelper {
             : _make_binary_data_array_field(element, number_of_tuples);
     }
 
+    // ascii data is parsed entirely, and the requested byte ranges are copied from the parsed values
+    FieldPtr _make_ascii_data_array_field(const XMLElement& e,
+                                          const std::size_t num_tuples,
+                                          const std::size_t num_selected_tuples,
+                                          std::vector<std::array<std::size_t, 2>> byte_ranges) const {
+        const auto num_values = _expected_layout(e, num_tuples).number_of_entries();
+        return from_precision_attribute(e.get_attribute("type")).visit([&] <typename T> (const Precision<T>& prec) {
+            return make_field_ptr(LazyField{
+                std::string{_filename},
+                _expected_layout(e, num_selected_tuples),
+                prec,
+                [_nv=num_values, _bounds=_parser.get_content_bounds(e), _ranges=std::move(byte_ranges)] (std::string filename) {
+                    std::ifstream file{filename};
+                    file.seekg(_bounds.begin_pos);
+                    Serialization values{_nv*sizeof(T)};
+                    XMLDetail::DataArrayReader<T>{file}.read_ascii(
+                        _nv, values, static_cast<std::size_t>(_bounds.end_pos - _bounds.begin_pos)
+                    );
+                    Serialization result;
+                    XMLDetail::_copy_byte_ranges(values, _ranges, result);
+                    return result;
+                }
+            });
+        });
+    }
+
+    FieldPtr _make_binary_data_array_field(const XMLElement& e,
+                                           const std::size_t num_selected_tuples,
+                                           std::vector<std::array<std::size_t, 2>> byte_ranges) const {
+        auto expected_layout = _expected_layout(e, num_selected_tuples);
+        return from_precision_attribute(e.get_attribute("type")).visit([&] <typename T> (const Precision<T>& prec) {
+            FieldPtr result;
+            _apply_decoder_for(e, [&] (const auto& decoder) {
+                result = make_field_ptr(LazyField{
+                    std::string{_filename},
+                    std::move(expected_layout),
+                    prec,
+                    [
+                        _loc=_stream_location_for(e),
+                        _header_prec=_header_precision(),
+                        _endian=from_endian_attribute(get().get_attribute("byte_order")),
+                        _comp=_compressor_for(e),
+                        _filter=Compression::pre_filter_from_string(
+                            e.get_attribute_or(std::string{""}, "GridFormatPreFilter")
+                        ),
+                        _decoder=decoder,
+                        _ranges=std::move(byte_ranges)
+                    ] (std::string filename) {
+                        std::ifstream file{filename, std::ios::binary};
+                        XMLDetail::_move_to_data(_loc, file);
+                        return _header_prec.visit([&] <typename H> (const Precision<H>&) {
+                            Serialization result;
+                            XMLDetail::DataArrayReader<T, H>{file, _endian, _comp, _filter}.read_binary_ranges(
+                                _decoder, _ranges, result
+                            );
+                            return result;
+                        });
+                    }
+                });
+            });
+            return result;
+        });
+    }
+
     FieldPtr _make_ascii_data_array_field(const XMLElement& e, const std::size_t num_tuples) const {
         MDLayout expected_layout = _expected_layout(e, num_tuples);
         auto num_values = expected_layout.number_of_entries();
@@ -849,11 +1412,13 @@ class XMLReaderHelper {
                 std::string{_filename},
                 std::move(expected_layout),
                 prec,
-                [_nv=num_values, _begin=_parser.get_content_bounds(e).begin_pos] (std::string filename) {
+                [_nv=num_values, _bounds=_parser.get_content_bounds(e)] (std::string filename) {
                     std::ifstream file{filename};
-                    file.seekg(_begin);
+                    file.seekg(_bounds.begin_pos);
                     Serialization result{_nv*sizeof(T)};
-                    XMLDetail::DataArrayReader<T>{file}.read_ascii(_nv, result);
+                    XMLDetail::DataArrayReader<T>{file}.read_ascii(
+                        _nv, result, static_cast<std::size_t>(_bounds.end_pos - _bounds.begin_pos)
+                    );
                     return result;
                 }
             });
@@ -864,8 +1429,8 @@ class XMLReaderHelper {
         auto expected_layout = _expected_layout(e, num_tuples);
         return from_precision_attribute(e.get_attribute("type")).visit([&] <typename T> (const Precision<T>& prec) {
             FieldPtr result;
-            _apply_decoder_for(e, [&] (auto&& decoder) {
-                result = make_field_ptr(LazyField{
+            _apply_decoder_for(e, [&] (const auto& decoder) {
+                result = make_field_ptr(PassThroughField{make_field_ptr(LazyField{
                     std::string{_filename},
                     std::move(expected_layout),
                     prec,
@@ -873,23 +1438,62 @@ class XMLReaderHelper {
                         _loc=_stream_location_for(e),
                         _header_prec=_header_precision(),
                         _endian=from_endian_attribute(get().get_attribute("byte_order")),
-                        _comp=get().get_attribute_or(std::string{""}, "compressor"),
-                        _decoder=std::move(decoder)
+                        _comp=_compressor_for(e),
+                        _filter=Compression::pre_filter_from_string(
+                            e.get_attribute_or(std::string{""}, "GridFormatPreFilter")
+                        ),
+                        _decoder=decoder
                     ] (std::string filename) {
                         std::ifstream file{filename};
                         XMLDetail::_move_to_data(_loc, file);
                         return _header_prec.visit([&] <typename H> (const Precision<H>&) {
                             Serialization result;
-                            XMLDetail::DataArrayReader<T, H>{file, _endian, _comp}.read_binary(_decoder, {}, result);
+                            XMLDetail::DataArrayReader<T, H>{file, _endian, _comp, _filter}.read_binary(_decoder, {}, result);
                             return result;
                         });
                     }
-                });
+                }), _make_payload<T>(e, decoder)});
             });
             return result;
         });
     }
 
+    template<typename T, typename Decoder>
+    DataArrayPayload _make_payload(const XMLElement& e, const Decoder& decoder) const {
+        static constexpr bool is_base64 = std::is_same_v<std::remove_cvref_t<Decoder>, Base64Decoder>;
+        const auto header_prec = _header_precision();
+        const auto compressor = _compressor_for(e);
+        const auto endian = from_endian_attribute(get().get_attribute("byte_order"));
+        return DataArrayPayload{
+            .encoding = is_base64 ? "base64" : "raw",
+            .compressor = compressor,
+            .header_type = attribute_name(header_prec),
+            .pre_filter = e.get_attribute_or(std::string{""}, "GridFormatPreFilter"),
+            .byte_order = endian,
+            .read = [
+                _filename=std::string{_filename},
+                _loc=_stream_location_for(e),
+                _header_prec=header_prec,
+                _endian=endian,
+                _comp=compressor,
+                _decoder=decoder
+            ] () {
+                std::ifstream file{_filename, std::ios::binary};
+                XMLDetail::_move_to_data(_loc, file);
+                const auto begin = file.tellg();
+                return _header_prec.visit([&] <typename H> (const Precision<H>&) -> Serialization {
+                    if constexpr (std::unsigned_integral<H> && sizeof(H) >= 4) {
+                        std::vector<H> header;
+                        XMLDetail::DataArrayReader<T, H>{file, _endian, _comp}.read_binary(_decoder, header);
+                        return XMLDetail::read_data_array_payload(file, begin, header, !_comp.empty(), is_base64);
+                    } else {
+                        throw IOError("Unsupported header type");
+                    }
+                });
+            }
+        };
+    }
+
     DynamicPrecision _header_precision() const {
         if (get().has_attribute("header_type"))
             return from_precision_attribute(get().get_attribute("header_type"));
@@ -931,26 +1535,23 @@ class XMLReaderHelper {
 
     std::size_t _deduce_number_of_values(const XMLElement& element) const {
         std::ifstream file{_filename};
-        XMLDetail::_move_to_data(_stream_location_for(element), file);
-
         if (element.get_attribute("format") == "ascii") {
-            const auto precision = from_precision_attribute(element.get_attribute("type"));
-            return precision.visit([&] <typename T> (const Precision<T>&) {
-                using _T = std::conditional_t<
-                    std::integral<T> && sizeof(T) < 4,  // see XMLDetail::DataArrayReader::read_ascii
-                    int,
-                    T
-                >;
-                return std::ranges::distance(std::ranges::istream_view<_T>{file});
-            });
+            const auto& bounds = _parser.get_content_bounds(element);
+            std::string chars(static_cast<std::size_t>(bounds.end_pos - bounds.begin_pos), '\0');
+            file.seekg(bounds.begin_pos);
+            file.read(chars.data(), static_cast<std::streamsize>(chars.size()));
+            return XMLDetail::_count_ascii_values(std::string_view{chars}.substr(0, file.gcount()));
         }
 
+        XMLDetail::_move_to_data(_stream_location_for(element), file);
+
         InputStreamHelper helper{file};
         const auto header = _read_binary_data_array_header(helper, element);
-        if (get().has_attribute("compressor") && header.size() < 3)
+        const bool is_compressed = !_compressor_for(element).empty();
+        if (is_compressed && header.size() < 3)
             throw ValueError("Could not read compression header");
         const std::size_t number_of_bytes = [&] () {
-            if (get().has_attribute("compressor")) {
+            if (is_compressed) {
                 const auto num_full_blocks = header.at(0);
                 const auto full_block_size = header.at(1);
                 const auto residual_block_size = header.at(2);
@@ -973,6 +1574,15 @@ class XMLReaderHelper {
         return number_of_bytes/value_type_number_of_bytes;
     }
 
+    // arrays written with adaptive compression store their compressor ("none" if uncompressed)
+    std::string _compressor_for(const XMLElement& data_array) const {
+        if (data_array.has_attribute("GridFormatCompressor")) {
+            const auto compressor = data_array.get_attribute("GridFormatCompressor");
+            return compressor == "none" ? "" : compressor;
+        }
+        return get().get_attribute_or(std::string{""}, "compressor");
+    }
+
     DataArrayStreamLocation _stream_location_for(const XMLElement& element) const {
         if (element.get_attribute("format") == "appended")
             return DataArrayStreamLocation{
@@ -984,7 +1594,7 @@ class XMLReaderHelper {
 
     std::vector<std::size_t> _read_binary_data_array_header(InputStreamHelper& stream,
                                                             const XMLElement& element) const {
-        const std::string compressor = get().get_attribute_or(std::string{""}, "compressor");
+        const std::string compressor = _compressor_for(element);
         const std::endian endian = from_endian_attribute(get().get_attribute("byte_order"));
         const auto header_prec = _header_precision();
         const auto values_prec = from_precision_attribute(element.get_attribute("type"));
@@ -168,6 +168,22 @@ class Writer {
         return _writer->write(filename);
     }
 
+    /*!
+     * \brief Write the grid and data into the given sink instead of a file.
+     * \param filename The name of file that would be written (without extension).
+     * \param sink The sink that receives the created files as in-memory buffers.
+     * \note Calling this function is only allowed if the writer was created as
+     *       a grid file writer. Not all writers support sinks, in which case an
+     *       exception is thrown.
+     */
+    std::string write(const std::string& filename, OutputSink& sink) const {
+        if (!_writer)
+            throw InvalidState(
+                "Writer was constructed as a time series writer. Only write(Scalar) can be used."
+            );
+        return _writer->write(filename, sink);
+    }
+
     /*!
      * \brief Write a time step in a time series.
      * \param time_value The time corresponding to this time step.
@@ -96,6 +96,15 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
     "vtp_to_vtu"_test = [&] () { test(grid, GridFormat::vtp, GridFormat::vtu, "vtp_to_vtu", comm); };
     "vti_to_vtu"_test = [&] () { test(grid, GridFormat::vti, GridFormat::vtu, "vti_to_vtu", comm); };
     "vtr_to_vtu"_test = [&] () { test(grid, GridFormat::vtr, GridFormat::vtu, "vtr_to_vtu", comm); };
+    "converter_keeps_coordinate_precision"_test = [&] () {
+        using GridFormat::Testing::expect;
+        const auto in_fmt = GridFormat::vtu.with({.coordinate_precision = GridFormat::float32});
+        test(grid, in_fmt, GridFormat::vtu, "float32_vtu_to_vtu", comm);
+
+        auto reader = is_parallel ? GridFormat::Reader{GridFormat::vtu, comm} : GridFormat::Reader{GridFormat::vtu};
+        reader.open(filename_prefix() + "float32_vtu_to_vtu_out_2d_in_2d" + (is_parallel ? ".pvtu" : ".vtu"));
+        expect(reader.points()->precision() == GridFormat::DynamicPrecision{GridFormat::float32});
+    };
 
 #if GRIDFORMAT_HAVE_HIGH_FIVE
     "vtu_to_vtk_hdf"_test = [&] () {
@@ -158,6 +167,30 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
     if (rank == 0)
         std::cout << "Wrote converted time series to '" << ts_converted_filename << "'" << std::endl;
 
+    "converted_time_series_matches_input"_test = [&] () {
+        using GridFormat::Testing::expect;
+        using GridFormat::Testing::eq;
+        auto in_reader = is_parallel ? GridFormat::Reader{GridFormat::pvd, comm} : GridFormat::Reader{GridFormat::pvd};
+        auto out_reader = is_parallel ? GridFormat::Reader{GridFormat::pvd, comm} : GridFormat::Reader{GridFormat::pvd};
+        in_reader.open(ts_filename);
+        out_reader.open(ts_converted_filename);
+        expect(eq(out_reader.number_of_steps(), in_reader.number_of_steps()));
+        for (std::size_t step = 0; step < in_reader.number_of_steps(); ++step) {
+            in_reader.set_step(step);
+            out_reader.set_step(step);
+            expect(eq(out_reader.time_at_step(step), in_reader.time_at_step(step)));
+            expect(eq(out_reader.number_of_cells(), in_reader.number_of_cells()));
+            expect(std::ranges::equal(
+                in_reader.point_field("pscalar")->serialized().as_span(),
+                out_reader.point_field("pscalar")->serialized().as_span()
+            ));
+            expect(std::ranges::equal(
+                in_reader.cell_field("cscalar")->serialized().as_span(),
+                out_reader.cell_field("cscalar")->serialized().as_span()
+            ));
+        }
+    };
+
     // test automatic format conversion to time series when non-time-series format is given
     const auto ts_auto_converted_filename = convert_time_series_to(
         GridFormat::vtu,
@@ -299,6 +299,25 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
         GridFormat::Testing::expect(throws<GridFormat::IOError>([&] () { r.open(vti_filename); }));
     };
 
+    "generic_reader_deduces_format_from_file_header"_test = [&] () {
+        const auto written = make_writer(GridFormat::vtu, grid, comm).write(
+            generated_data_folder / make_filename("header_probe")
+        );
+        const auto renamed = generated_data_folder / (make_filename("header_probe") + ".data");
+        if (GridFormat::Parallel::rank(comm) == 0)
+            std::filesystem::copy_file(written, renamed, std::filesystem::copy_options::overwrite_existing);
+        GridFormat::Parallel::barrier(comm);
+
+        GridFormat::Reader any_reader{GridFormat::any, comm};
+        any_reader.open(renamed);
+        expect(eq(any_reader.name(), std::string{is_parallel ? "PVTUReader" : "VTUReader"}));
+
+        GridFormat::Reader vtu_reader{GridFormat::vtu, comm};
+        vtu_reader.open(written);
+        expect(eq(vtu_reader.name(), any_reader.name()));
+        expect(eq(vtu_reader.number_of_cells(), any_reader.number_of_cells()));
+    };
+
     // check that reader exposes image/rectilinear grid-specific interfaces
     if (!is_parallel) {
         const auto _vti_test = [&] (auto& vti_reader) {
@@ -206,6 +206,70 @@ int main() {
         ));
     };
 
+    "transformed_field_extend_scalar_vector"_test = [] () {
+        auto field_ptr = GridFormat::make_field_ptr(
+            RangeField{
+                std::vector<std::array<int, 1>>{{2}, {4}, {6}},
+                GridFormat::Precision<float>{}
+            }
+        );
+        TransformedField field_3d{field_ptr, extend_all_to(3)};
+        expect(eq(field_3d.layout().extent(0), 3_ul));
+        expect(eq(field_3d.layout().extent(1), 3_ul));
+        expect(std::ranges::equal(
+            field_3d.serialized().template as_span_of<float>(),
+            std::vector<float>{2, 0, 0, 4, 0, 0, 6, 0, 0}
+        ));
+    };
+
+    "transformed_field_extend_tensor"_test = [] () {
+        auto field_ptr = GridFormat::make_field_ptr(
+            RangeField{
+                std::vector<std::array<std::array<int, 2>, 2>>{
+                    {{{1, 2}, {3, 4}}},
+                    {{{5, 6}, {7, 8}}}
+                },
+                GridFormat::Precision<double>{}
+            }
+        );
+        TransformedField field_3d{field_ptr, extend_all_to(3)};
+        expect(eq(field_3d.layout().dimension(), 3_ul));
+        expect(eq(field_3d.layout().extent(0), 2_ul));
+        expect(eq(field_3d.layout().extent(1), 3_ul));
+        expect(eq(field_3d.layout().extent(2), 3_ul));
+        expect(std::ranges::equal(
+            field_3d.serialized().template as_span_of<double>(),
+            std::vector<double>{
+                1, 2, 0, 3, 4, 0, 0, 0, 0,
+                5, 6, 0, 7, 8, 0, 0, 0, 0
+            }
+        ));
+
+        TransformedField field_rows_only{field_ptr, extend_to(GridFormat::MDLayout{{3, 2}})};
+        expect(std::ranges::equal(
+            field_rows_only.serialized().template as_span_of<double>(),
+            std::vector<double>{1, 2, 3, 4, 0, 0, 5, 6, 7, 8, 0, 0}
+        ));
+    };
+
+    "transformed_field_extend_higher_rank"_test = [] () {
+        auto field_ptr = GridFormat::make_field_ptr(
+            RangeField{
+                std::vector<std::array<std::array<std::array<int, 1>, 1>, 2>>{
+                    {{{{1}}, {{2}}}},
+                    {{{{3}}, {{4}}}}
+                },
+                GridFormat::Precision<int>{}
+            }
+        );
+        TransformedField extended{field_ptr, extend_to(GridFormat::MDLayout{{2, 1, 2}})};
+        expect(eq(extended.layout().dimension(), 4_ul));
+        expect(std::ranges::equal(
+            extended.serialized().template as_span_of<int>(),
+            std::vector<int>{1, 0, 2, 0, 3, 0, 4, 0}
+        ));
+    };
+
     "transformed_field_extend_1d_throws"_test = [] () {
         auto field_ptr = GridFormat::make_field_ptr(RangeField{
             std::vector<int>{2, 3}, GridFormat::Precision<double>{}
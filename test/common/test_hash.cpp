@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <gridformat/common/hash.hpp>
+#include "../testing.hpp"
+
+std::span<const std::byte> as_bytes(const std::string& s) {
+    return std::as_bytes(std::span{s.data(), s.size()});
+}
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    "xxhash64_reference_values"_test = [] () {
+        expect(eq(GridFormat::xxhash64(as_bytes("")), std::uint64_t{0xEF46DB3751D8E999ULL}));
+        expect(eq(GridFormat::xxhash64(as_bytes("a")), std::uint64_t{0xD24EC4F1A98C6E5BULL}));
+        expect(eq(GridFormat::xxhash64(as_bytes("abc")), std::uint64_t{0x44BC2CF5AD770999ULL}));
+    };
+
+    "xxhash64_detects_changes"_test = [] () {
+        std::vector<double> values(100, 1.0);
+        const auto hash = GridFormat::xxhash64(std::as_bytes(std::span{values}));
+        expect(eq(GridFormat::xxhash64(std::as_bytes(std::span{values})), hash));
+        values[42] = 2.0;
+        expect(GridFormat::xxhash64(std::as_bytes(std::span{values})) != hash);
+        expect(GridFormat::xxhash64(std::as_bytes(std::span{values}), 1) != GridFormat::xxhash64(std::as_bytes(std::span{values})));
+    };
+
+    return 0;
+}
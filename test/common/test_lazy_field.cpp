@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+#include <algorithm>
+
+#include <gridformat/common/lazy_field.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    const std::vector<int> values{1, 2, 3, 4};
+    int number_of_reads = 0;
+    const auto make_field = [&] () {
+        return GridFormat::LazyField{
+            values,
+            GridFormat::MDLayout{{values.size()}},
+            GridFormat::DynamicPrecision{GridFormat::int32},
+            [&] (const std::vector<int>& source) {
+                number_of_reads++;
+                GridFormat::Serialization result{source.size()*sizeof(int)};
+                std::ranges::copy(source, result.as_span_of(GridFormat::int32).begin());
+                return result;
+            }
+        };
+    };
+
+    "lazy_field_reads_upon_request"_test = [&] () {
+        number_of_reads = 0;
+        const auto field = make_field();
+        expect(eq(number_of_reads, 0));
+        expect(std::ranges::equal(field.serialized().as_span_of(GridFormat::int32), values));
+        expect(std::ranges::equal(field.serialized().as_span_of(GridFormat::int32), values));
+        expect(eq(number_of_reads, 2));
+    };
+
+    "lazy_field_prefetch"_test = [&] () {
+        number_of_reads = 0;
+        const auto field = make_field();
+        field.prefetch();
+        field.prefetch();
+        expect(eq(number_of_reads, 1));
+        expect(std::ranges::equal(field.serialized().as_span_of(GridFormat::int32), values));
+        expect(std::ranges::equal(field.serialized().as_span_of(GridFormat::int32), values));
+        expect(eq(number_of_reads, 1));
+    };
+
+    return 0;
+}
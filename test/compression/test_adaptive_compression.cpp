@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+
+#include <gridformat/common/type_traits.hpp>
+#include <gridformat/compression/adaptive.hpp>
+#include "../testing.hpp"
+
+template<typename Candidate>
+bool is_uncompressed(const Candidate& candidate) {
+    return std::holds_alternative<GridFormat::None>(candidate);
+}
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    namespace Compression = GridFormat::Compression;
+
+    "adaptive_compression_leaves_small_arrays_uncompressed"_test = [] () {
+        const std::vector<std::byte> data(100, std::byte{0});
+        expect(is_uncompressed(Compression::adaptive.select(data)));
+    };
+
+    "adaptive_compression_without_candidates"_test = [] () {
+        const std::vector<std::byte> data(100000, std::byte{0});
+        const Compression::Adaptive adaptive{{}, {}};
+        expect(is_uncompressed(adaptive.select(data)));
+    };
+
+    "adaptive_compression_selects_compressor_for_redundant_data"_test = [] () {
+        const std::vector<std::byte> data(1000000, std::byte{42});
+        // with a slow output, compressing the (trivially compressible) data always pays off
+        const auto adaptive = Compression::Adaptive::with({.write_bandwidth = 1e3});
+        const auto selected = adaptive.select(data);
+        expect(adaptive.candidates().empty() || !is_uncompressed(selected));
+    };
+
+    "adaptive_compression_leaves_random_data_uncompressed"_test = [] () {
+        std::vector<std::byte> data(1000000);
+        std::uint32_t state = 12345;
+        for (auto& byte : data) {
+            state = state*1664525u + 1013904223u;
+            byte = static_cast<std::byte>(state >> 24);
+        }
+        // with an infinitely fast output, compression never pays off
+        const auto adaptive = Compression::Adaptive::with({.write_bandwidth = 1e300});
+        expect(is_uncompressed(adaptive.select(data)));
+    };
+
+    "adaptive_compression_invalid_options"_test = [] () {
+        expect(throws<GridFormat::ValueError>([] () {
+            Compression::Adaptive::with({.number_of_sample_blocks = 0});
+        }));
+    };
+
+    return 0;
+}
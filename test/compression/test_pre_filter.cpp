@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <bit>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/compression/pre_filter.hpp>
+#include "../testing.hpp"
+
+template<typename T>
+GridFormat::Serialization serialize(const std::vector<T>& values) {
+    GridFormat::Serialization result{values.size()*sizeof(T)};
+    std::ranges::copy(values, result.template as_span_of<T>().begin());
+    return result;
+}
+
+template<typename T>
+bool is_restored(const GridFormat::Compression::PreFilter& filter, const std::vector<T>& values) {
+    auto data = serialize(values);
+    GridFormat::Compression::apply_pre_filter(filter, data, GridFormat::Precision<T>{});
+    GridFormat::Compression::undo_pre_filter(filter, data, GridFormat::Precision<T>{});
+    return std::ranges::equal(data.template as_span_of<T>(), values);
+}
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+    namespace Compression = GridFormat::Compression;
+
+    "pre_filter_byte_shuffle"_test = [] () {
+        auto data = serialize(std::vector<std::uint16_t>{0x0102, 0x0304, 0x0506});
+        Compression::apply_pre_filter(Compression::byte_shuffle, data, GridFormat::uint16);
+        const auto bytes = data.template as_span_of<std::uint8_t>();
+        if constexpr (std::endian::native == std::endian::little)
+            expect(std::ranges::equal(bytes, std::vector<std::uint8_t>{0x02, 0x04, 0x06, 0x01, 0x03, 0x05}));
+    };
+
+    "pre_filter_bit_shuffle"_test = [] () {
+        // the lowest bit is set in all values, thus, the first bit plane is all ones
+        auto data = serialize(std::vector<std::uint8_t>{1, 3, 5, 7, 9, 11, 13, 15, 42});
+        Compression::apply_pre_filter(Compression::bit_shuffle, data, GridFormat::uint8);
+        const auto bytes = data.template as_span_of<std::uint8_t>();
+        expect(eq(bytes[0], std::uint8_t{0xFF}));  // bit 0 of values 0-7
+        expect(eq(bytes[1], std::uint8_t{0xAA}));  // bit 1 of values 0-7
+        expect(eq(bytes[8], std::uint8_t{42}));  // remainder is left untouched
+    };
+
+    "pre_filter_delta"_test = [] () {
+        auto data = serialize(std::vector<int>{3, 4, 6, 2});
+        Compression::apply_pre_filter(Compression::delta, data, GridFormat::int32);
+        expect(std::ranges::equal(data.template as_span_of<int>(), std::vector<int>{3, 1, 2, -4}));
+    };
+
+    "pre_filter_delta_ignored_for_floating_point"_test = [] () {
+        auto data = serialize(std::vector<double>{1.0, 2.0, 4.0});
+        Compression::apply_pre_filter(Compression::delta, data, GridFormat::float64);
+        expect(std::ranges::equal(data.template as_span_of<double>(), std::vector<double>{1.0, 2.0, 4.0}));
+    };
+
+    "pre_filter_round_trips"_test = [] () {
+        std::vector<double> doubles(101);
+        std::vector<std::int64_t> ints(77);
+        std::vector<std::uint8_t> bytes(13);
+        std::ranges::generate(doubles, [i=0] () mutable { return 0.1*(i++); });
+        std::ranges::generate(ints, [i=0] () mutable { const auto v = i++; return v*((v%3) - 1)*1000; });
+        std::ranges::generate(bytes, [i=0] () mutable { return static_cast<std::uint8_t>((i++)*31); });
+        for (const auto shuffle : {Compression::Shuffle::none, Compression::Shuffle::byte, Compression::Shuffle::bit})
+            for (const bool delta : {false, true}) {
+                const Compression::PreFilter filter{.shuffle = shuffle, .delta = delta};
+                expect(is_restored(filter, doubles));
+                expect(is_restored(filter, ints));
+                expect(is_restored(filter, bytes));
+            }
+    };
+
+    "pre_filter_string_conversion"_test = [] () {
+        const Compression::PreFilter filter{.shuffle = Compression::Shuffle::bit, .delta = true};
+        expect(eq(Compression::as_string(filter), std::string{"delta,bit_shuffle"}));
+        expect(Compression::pre_filter_from_string(Compression::as_string(filter)) == filter);
+        expect(Compression::pre_filter_from_string("") == Compression::PreFilter{});
+        expect(throws<GridFormat::ValueError>([] () { Compression::pre_filter_from_string("unknown"); }));
+    };
+
+    return 0;
+}
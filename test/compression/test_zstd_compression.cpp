@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+#include <algorithm>
+
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/compression/zstd.hpp>
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+    using GridFormat::Testing::throws;
+
+    "zstd_compression_default_opts"_test = [] () {
+        GridFormat::Serialization bytes{1000};
+        GridFormat::Compression::ZSTD compressor;
+        const auto block_sizes = compressor.compress(bytes);
+        expect(block_sizes.compressed_size() <= 1000);
+    };
+
+    "zstd_compression_custom_block_size"_test = [] () {
+        GridFormat::Serialization bytes{1000};
+        const auto compressor = GridFormat::Compression::ZSTD::with({.block_size = 100});
+        const auto block_sizes = compressor.compress(bytes);
+        expect(block_sizes.compressed_size() <= 1000);
+        expect(block_sizes.number_of_blocks == 10);
+    };
+
+    "zstd_compression_custom_block_size_with_residual"_test = [] () {
+        GridFormat::Serialization bytes{1000};
+        const auto compressor = GridFormat::Compression::ZSTD::with({.block_size = 300});
+        const auto block_sizes = compressor.compress(bytes);
+        expect(block_sizes.compressed_size() <= 1000);
+        expect(block_sizes.number_of_blocks == 4);
+        expect(block_sizes.residual_block_size == 100);
+    };
+
+    "zstd_decompression_default"_test = [] () {
+        const std::vector<int> data{42, 43, 44, 45, 56, 66};
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization bytes{number_of_bytes};
+        std::ranges::for_each(
+            bytes.template as_span_of<int>(),
+            [&, i=int{0}] (int& value) mutable { value = data[i++]; }
+        );
+
+        GridFormat::Compression::ZSTD compressor;
+        const auto blocks = compressor.compress(bytes);
+        compressor.decompress(bytes, blocks);
+        expect(eq(bytes.size(), number_of_bytes));
+        expect(std::ranges::equal(bytes.template as_span_of<int>(), data));
+    };
+
+    "zstd_decompression_multiple_blocks"_test = [] () {
+        const std::vector<int> data{42, 43, 44, 45, 56, 66};
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization bytes{number_of_bytes};
+        std::ranges::for_each(
+            bytes.template as_span_of<int>(),
+            [&, i=int{0}] (int& value) mutable { value = data[i++]; }
+        );
+
+        GridFormat::Compression::ZSTD compressor{{.block_size = number_of_bytes/3}};
+        const auto blocks = compressor.compress(bytes);
+        compressor.decompress(bytes, blocks);
+        expect(eq(bytes.size(), number_of_bytes));
+        expect(std::ranges::equal(bytes.template as_span_of<int>(), data));
+    };
+
+    "zstd_decompression_with_level_and_long_distance_matching"_test = [] () {
+        std::vector<int> data(10000);
+        std::ranges::for_each(data, [i=int{0}] (int& value) mutable { value = (i++)%100; });
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization bytes{number_of_bytes};
+        std::ranges::copy(data, bytes.template as_span_of<int>().begin());
+
+        const auto compressor = GridFormat::Compression::ZSTD::with({
+            .block_size = number_of_bytes/2,
+            .compression_level = 19,
+            .long_distance_matching = true
+        });
+        const auto blocks = compressor.compress(bytes);
+        expect(blocks.compressed_size() < number_of_bytes/10);
+        compressor.decompress(bytes, blocks);
+        expect(eq(bytes.size(), number_of_bytes));
+        expect(std::ranges::equal(bytes.template as_span_of<int>(), data));
+    };
+
+    "zstd_compression_invalid_window_log"_test = [] () {
+        GridFormat::Serialization bytes{1000};
+        const auto compressor = GridFormat::Compression::ZSTD::with({.window_log = 1});
+        expect(throws<GridFormat::InvalidState>([&] () { compressor.compress(bytes); }));
+    };
+
+    return 0;
+}
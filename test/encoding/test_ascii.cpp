@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include <span>
+#include <cstdint>
 
 #include <gridformat/encoding/ascii.hpp>
 #include "../testing.hpp"
@@ -30,5 +31,35 @@ int main() {
         expect(eq(s.str(), std::string{"1,2,3,42,"}));
     };
 
+    "ascii_encoded_stream_floating_point_precision"_test = [] () {
+        std::ostringstream s;
+        std::vector<double> v{0.1, 1.0/3.0, 1e-20};
+        GridFormat::Encoding::Ascii::with({.delimiter = " "})(s).write(std::span{v});
+        expect(eq(s.str(), std::string{"0.1 0.333333333333333 1e-20 "}));
+    };
+
+    "ascii_encoded_stream_shortest_round_trip"_test = [] () {
+        std::ostringstream s;
+        std::vector<double> v{0.1, 1.0/3.0};
+        GridFormat::Encoding::Ascii::with({.delimiter = " ", .shortest_round_trip = true})(s).write(std::span{v});
+        expect(eq(s.str(), std::string{"0.1 0.3333333333333333 "}));
+    };
+
+    "ascii_encoded_stream_multithreaded"_test = [] () {
+        std::vector<std::uint16_t> v(300'000);
+        for (std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<std::uint16_t>(i%1000);
+
+        GridFormat::AsciiFormatOptions opts{.delimiter = " ", .line_prefix = "  ", .entries_per_line = 7};
+        std::ostringstream sequential;
+        GridFormat::Encoding::Ascii::with(opts)(sequential).write(std::span{v});
+
+        opts.num_threads = 4;
+        std::ostringstream threaded;
+        GridFormat::Encoding::Ascii::with(opts)(threaded).write(std::span{v});
+        expect(eq(sequential.str(), threaded.str()));
+        expect(sequential.str().starts_with("  0 1 2 3 4 5 6 \n  7 8"));
+    };
+
     return 0;
 }
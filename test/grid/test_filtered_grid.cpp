@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <type_traits>
+#include <algorithm>
 
 #include <gridformat/grid/filtered.hpp>
 #include <gridformat/grid/grid.hpp>
@@ -18,6 +19,20 @@ int main() {
 
     static_assert(Concepts::UnstructuredGrid<std::remove_cvref_t<decltype(filtered)>>);
     expect(eq(number_of_cells(filtered), std::size_t{1}));
+    expect(eq(number_of_points(filtered), test_grid.number_of_points()));
+
+    "compact_filtered_grid_exposes_only_connected_points"_test = [&] () {
+        const CompactFilteredGrid compact{test_grid, [] (const auto& e) { return e.id < 2; }};
+        static_assert(Concepts::UnstructuredGrid<std::remove_cvref_t<decltype(compact)>>);
+        expect(eq(number_of_cells(compact), std::size_t{2}));
+        expect(eq(number_of_points(compact), std::size_t{12}));
+        expect(eq(Ranges::size(points(compact)), std::size_t{12}));
+
+        const auto point_id_map = make_point_id_map(compact);
+        for (const auto& c : cells(compact))
+            for (const auto& p : points(compact, c))
+                expect(point_id_map.at(id(compact, p)) < std::size_t{12});
+    };
 
     return 0;
 }
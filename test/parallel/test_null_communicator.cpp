@@ -62,6 +62,19 @@ int main() {
             std::vector<int>{some_value}
         ));
     };
+    "null_communicator_all_gather"_test = [&] () {
+        expect(std::ranges::equal(
+            GridFormat::Parallel::all_gather(comm, some_value),
+            std::vector<int>{some_value}
+        ));
+    };
+    "null_communicator_all_gather_array"_test = [&] () {
+        std::array<int, 2> vals{some_value, some_value + 1};
+        expect(std::ranges::equal(
+            GridFormat::Parallel::all_gather(comm, vals),
+            std::vector<int>{some_value, some_value + 1}
+        ));
+    };
 
     return 0;
 }
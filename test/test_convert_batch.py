@@ -0,0 +1,90 @@
+# SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+# SPDX-License-Identifier: MIT
+
+from argparse import ArgumentParser
+from subprocess import run
+from os import makedirs, listdir
+from os.path import join, exists
+from shutil import rmtree
+
+
+VTI_FILE = """<?xml version="1.0"?>
+<VTKFile type="ImageData" version="2.2" byte_order="LittleEndian" header_type="UInt64">
+  <ImageData WholeExtent="0 2 0 2 0 0" Origin="0 0 0" Spacing="1 1 0">
+    <Piece Extent="0 2 0 2 0 0">
+      <CellData>
+        <DataArray type="Float64" Name="cfield" format="ascii">{0} {0} {0} {0}</DataArray>
+      </CellData>
+    </Piece>
+  </ImageData>
+</VTKFile>
+"""
+
+
+def write_vti_file(filename: str, value: int) -> None:
+    with open(filename, "w") as vti_file:
+        vti_file.write(VTI_FILE.format(value))
+
+
+def convert(cmd: list[str]) -> tuple[int, str]:
+    result = run(cmd, capture_output=True, text=True)
+    print(" ".join(cmd))
+    print(result.stdout)
+    return result.returncode, result.stdout
+
+
+def test_batch_conversion(convert_cmd: str, folder: str) -> None:
+    makedirs(join(folder, "in"))
+    for i in range(5):
+        write_vti_file(join(folder, "in", f"step_{i}.vti"), i)
+
+    out_folder = join(folder, "out")
+    returncode, _ = convert([convert_cmd, join(folder, "in", "step_*.vti"), "vtu", "-o", out_folder, "-j", "3"])
+    assert returncode == 0, "Batch conversion failed"
+    assert sorted(listdir(out_folder)) == [f"step_{i}_converted.vtu" for i in range(5)]
+
+    # conversions into vtk-hdf are carried out one at a time
+    out_folder = join(folder, "out_hdf")
+    returncode, output = convert([convert_cmd, join(folder, "in", "step_*.vti"), "vtk-hdf", "-o", out_folder, "-j", "3"])
+    if "missing dependency" in output:
+        print("Skipping vtk-hdf batch conversion due to missing dependency")
+    else:
+        assert returncode == 0, "Batch conversion into vtk-hdf failed"
+        assert len(listdir(out_folder)) == 5
+
+
+def test_batch_output_collisions(convert_cmd: str, folder: str) -> None:
+    for sub_folder in ["a", "b"]:
+        makedirs(join(folder, sub_folder))
+        write_vti_file(join(folder, sub_folder, "step.vti"), 1)
+
+    list_filename = join(folder, "files.txt")
+    with open(list_filename, "w") as list_file:
+        list_file.write(join(folder, "a", "step.vti") + "\n")
+        list_file.write(join(folder, "b", "step.vti") + "\n")
+
+    # both files would be written into the same output file
+    out_folder = join(folder, "out")
+    returncode, output = convert([convert_cmd, f"@{list_filename}", "vtu", "-o", out_folder])
+    assert returncode != 0, "Expected conversion to fail due to colliding output files"
+    assert "same output file" in output
+    assert not exists(out_folder)
+
+    # without an output folder, the files are written next to the inputs
+    returncode, _ = convert([convert_cmd, f"@{list_filename}", "vtu"])
+    assert returncode == 0, "Batch conversion failed"
+    assert exists(join(folder, "a", "step_converted.vtu"))
+    assert exists(join(folder, "b", "step_converted.vtu"))
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser()
+    parser.add_argument("-c", "--convert-command", required=True)
+    args = vars(parser.parse_args())
+
+    for test in [test_batch_conversion, test_batch_output_collisions]:
+        folder = f"__{test.__name__}"
+        if exists(folder):
+            rmtree(folder)
+        test(args["convert_command"], folder)
+        rmtree(folder)
@@ -8,6 +8,9 @@
 #include <gridformat/vtk/vts_writer.hpp>
 
 #include <memory>
+#include <string>
+#include <algorithm>
+#include <vector>
 
 #include <gridformat/vtk/pvd_writer.hpp>
 #include <gridformat/vtk/pvd_reader.hpp>
@@ -69,5 +72,75 @@ int main() {
         expect(eq(pvd_vtu_reader.number_of_pieces(), std::size_t{1}));
     };
 
+    "pvd_reader_reuses_cached_step_readers"_test = [&] () {
+        std::size_t num_opened = 0;
+        GridFormat::PVDReader counting_reader{[&] (const std::string&) {
+            ++num_opened;
+            return std::make_unique<GridFormat::VTUReader>();
+        }};
+        counting_reader.set_options({.step_cache_size = 2});
+        counting_reader.open(pvd_vtu_file);
+        expect(counting_reader.number_of_steps() > 2);
+        counting_reader.set_step(1);
+        counting_reader.set_step(0);
+        counting_reader.set_step(1);
+        expect(eq(num_opened, std::size_t{2}));
+        counting_reader.set_step(2);
+        counting_reader.set_step(0);
+        expect(eq(num_opened, std::size_t{4}));
+    };
+
+    "pvd_reader_field_history"_test = [&] () {
+        GridFormat::PVDReader reader;
+        reader.open(pvd_vtu_file);
+        const std::vector<std::size_t> cells{7, 0, 3, 4, 7};
+        const std::vector<std::size_t> points{29, 1};
+        const auto names = cell_field_names(reader);
+        for (const auto& name : names) {
+            const auto history = reader.cell_field_history(name, cells);
+            expect(eq(history.size(), reader.number_of_steps()));
+            for (std::size_t step = 0; step < reader.number_of_steps(); ++step) {
+                reader.set_step(step);
+                const auto all = reader.cell_field(name)->template export_to<std::vector<double>>();
+                const auto probed = history[step]->template export_to<std::vector<double>>();
+                const auto num_components = all.size()/reader.number_of_cells();
+                expect(eq(probed.size(), cells.size()*num_components));
+                for (std::size_t i = 0; i < cells.size(); ++i)
+                    for (std::size_t c = 0; c < num_components; ++c)
+                        expect(eq(probed[i*num_components + c], all[cells[i]*num_components + c]));
+            }
+        }
+        const auto point_history = reader.point_field_history("pscalar", points);
+        reader.set_step(reader.number_of_steps() - 1);
+        const auto all = reader.point_field("pscalar")->template export_to<std::vector<double>>();
+        const auto probed = point_history.back()->template export_to<std::vector<double>>();
+        expect(eq(probed.at(0), all.at(29)));
+        expect(eq(probed.at(1), all.at(1)));
+        expect(throws<GridFormat::ValueError>([&] () {
+            reader.cell_field_history("cscalar", std::vector<std::size_t>{1000}).front()->serialized();
+        }));
+    };
+
+    "pvd_reader_prefetched_steps_match"_test = [&] () {
+        GridFormat::PVDReader reference_reader;
+        GridFormat::PVDReader prefetching_reader;
+        reference_reader.set_options({.step_cache_size = 1});
+        prefetching_reader.set_options({.step_cache_size = 1, .prefetch_next_step = true});
+        reference_reader.open(pvd_vtu_file);
+        prefetching_reader.open(pvd_vtu_file);
+        for (const std::size_t step : {0, 1, 2, 1, 3, 4, 0}) {
+            if (step >= reference_reader.number_of_steps())
+                continue;
+            reference_reader.set_step(step);
+            prefetching_reader.set_step(step);
+            expect(eq(prefetching_reader.time_at_step(step), reference_reader.time_at_step(step)));
+            for (const auto& [name, field] : point_fields(reference_reader))
+                expect(std::ranges::equal(
+                    prefetching_reader.point_field(name)->serialized().as_span(),
+                    field->serialized().as_span()
+                ));
+        }
+    };
+
     return 0;
 }
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: MIT
 
 #include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
 
 #include <mpi.h>
 
@@ -11,6 +14,7 @@
 
 #include "../grid/structured_grid.hpp"
 #include "../make_test_data.hpp"
+#include "../testing.hpp"
 #include "vtk_writer_tester.hpp"
 
 template<typename Grid, typename Communicator>
@@ -123,6 +127,40 @@ int main(int argc, char** argv) {
     //     });
     // }
 
+    // writers reuse the decomposition of previous writes, check that it is recomputed upon grid changes
+    {
+        using GridFormat::Testing::operator""_test;
+        using GridFormat::Testing::expect;
+
+        const auto read_file = [] (const std::string& filename) {
+            std::ifstream file{filename};
+            return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        };
+
+        GridFormat::Test::StructuredGrid<2> grid{{{1.0, 1.0}}, {{2, 3}}, {{xoffset, yoffset}}};
+        GridFormat::PVTIWriter writer{grid, MPI_COMM_WORLD};
+        writer.write("decomposition_cache_test");
+        const auto first = read_file("decomposition_cache_test.pvti");
+        writer.write("decomposition_cache_test");
+        const auto second = read_file("decomposition_cache_test.pvti");
+
+        grid.invert();
+        writer.write("decomposition_cache_test");
+        const auto after_change = read_file("decomposition_cache_test.pvti");
+        GridFormat::PVTIWriter{grid, MPI_COMM_WORLD}.write("decomposition_cache_test");
+        const auto from_new_writer = read_file("decomposition_cache_test.pvti");
+
+        if (rank == 0) {
+            "pvti_writer_reuses_decomposition"_test = [&] () {
+                expect(first == second);
+            };
+            "pvti_writer_recomputes_decomposition_after_grid_change"_test = [&] () {
+                expect(after_change == from_new_writer);
+                expect(after_change != first);
+            };
+        }
+    }
+
     MPI_Finalize();
     return 0;
 }
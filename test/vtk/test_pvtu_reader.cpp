@@ -253,6 +253,50 @@ int main(int argc, char** argv) {
         }
     }
 
+    // test that the pieces of groups of ranks can be aggregated into one piece file per group
+    GridFormat::Parallel::barrier(world_comm);
+    {
+        const auto grid = GridFormat::Test::make_unstructured_2d(world_rank);
+        GridFormat::PVTUWriter writer{grid, world_comm, {}, GridFormat::PVTK::PieceAggregation{.ranks_per_file = 2}};
+        const auto filename = GridFormat::Test::write_test_file<2>(
+            writer, "reader_pvtu_test_file_2d_in_2d_aggregated", {}, (world_rank == 0)
+        );
+
+        if (world_rank == 0) {
+            GridFormat::PVTUReader reader{};
+            reader.open(filename);
+            const auto sequential_grid = [&] () {
+                GridFormat::Test::UnstructuredGridFactory<2, 2> factory;
+                reader.export_grid(factory);
+                return std::move(factory).grid();
+            } ();
+
+            "aggregated_pvtu_number_of_pieces"_test = [&] () {
+                expect(eq(reader.number_of_pieces(), std::size_t{2}));
+            };
+
+            "aggregated_pvtu_number_of_entities"_test = [&] () {
+                expect(eq(reader.number_of_cells(), num_cells_per_rank*4));
+                expect(eq(reader.number_of_points(), num_points_per_rank*4));
+                expect(eq(GridFormat::number_of_cells(sequential_grid), num_cells_per_rank*4));
+                expect(eq(GridFormat::number_of_points(sequential_grid), num_points_per_rank*4));
+            };
+
+            "aggregated_pvtu_field_values"_test = [&] () {
+                expect(GridFormat::Ranges::size(point_fields(reader)) > 0);
+                expect(GridFormat::Ranges::size(cell_fields(reader)) > 0);
+                for (const auto& [name, field_ptr] : point_fields(reader))
+                    expect(GridFormat::Test::test_field_values<2>(
+                        name, field_ptr, sequential_grid, GridFormat::points(sequential_grid)
+                    ));
+                for (const auto& [name, field_ptr] : cell_fields(reader))
+                    expect(GridFormat::Test::test_field_values<2>(
+                        name, field_ptr, sequential_grid, GridFormat::cells(sequential_grid)
+                    ));
+            };
+        }
+    }
+
     MPI_Finalize();
     return 0;
 }
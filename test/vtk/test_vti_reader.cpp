@@ -1,7 +1,11 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <array>
 #include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include <filesystem>
 #include <iterator>
 #include <ranges>
@@ -22,6 +26,11 @@
 
 
 int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+
     const GridFormat::Test::StructuredGrid<2> grid{
         {1.0, 1.0},
         {4, 5}
@@ -35,6 +44,82 @@ int main() {
         "reader_vti_test_file_2d_in_2d"
     );
 
+    "vti_region_read"_test = [&] () {
+        const GridFormat::Test::StructuredGrid<3> grid_3d{{1.0, 1.0, 1.0}, {5, 4, 3}};
+        const auto test_data = GridFormat::Test::make_test_data<3>(grid_3d, GridFormat::float64);
+        const GridFormat::GridReader::PieceLocation region{{1, 1, 0}, {4, 3, 2}};
+
+        // expected values are the entries of the full field within the region
+        const auto expect_region = [] (const GridFormat::FieldPtr& full,
+                                       const GridFormat::FieldPtr& partial,
+                                       const std::array<std::size_t, 3>& piece_count,
+                                       const std::array<std::size_t, 3>& offset,
+                                       const std::array<std::size_t, 3>& count) {
+            const auto full_values = full->serialized();
+            const auto partial_values = partial->serialized();
+            const auto entry_size = full_values.size()/full->layout().extent(0);
+            expect(eq(partial->layout().extent(0), count[0]*count[1]*count[2]));
+            expect(eq(partial_values.size(), count[0]*count[1]*count[2]*entry_size));
+            std::size_t i = 0;
+            for (std::size_t z = 0; z < count[2]; ++z)
+                for (std::size_t y = 0; y < count[1]; ++y)
+                    for (std::size_t x = 0; x < count[0]; ++x, ++i) {
+                        const auto idx = offset[0] + x + piece_count[0]*(offset[1] + y + piece_count[1]*(offset[2] + z));
+                        expect(std::ranges::equal(
+                            partial_values.as_span().subspan(i*entry_size, entry_size),
+                            full_values.as_span().subspan(idx*entry_size, entry_size)
+                        ));
+                    }
+        };
+
+        for (const auto& [name, opts] : std::vector<std::pair<std::string, GridFormat::VTK::XMLOptions>>{
+            {"ascii", {.encoder = GridFormat::Encoding::ascii}},
+            {"base64_inlined", {.encoder = GridFormat::Encoding::base64, .compressor = GridFormat::none,
+                                .data_format = GridFormat::VTK::DataFormat::inlined}},
+            {"raw_appended", {.encoder = GridFormat::Encoding::raw, .compressor = GridFormat::none,
+                              .data_format = GridFormat::VTK::DataFormat::appended,
+                              .header_precision = GridFormat::uint32}},
+#if GRIDFORMAT_HAVE_ZLIB
+            {"base64_zlib", {.encoder = GridFormat::Encoding::base64,
+                             .compressor = GridFormat::Compression::zlib.with({.block_size = 100}),
+                             .data_format = GridFormat::VTK::DataFormat::appended}},
+            {"raw_zlib", {.encoder = GridFormat::Encoding::raw,
+                          .compressor = GridFormat::Compression::zlib.with({.block_size = 64}),
+                          .data_format = GridFormat::VTK::DataFormat::appended,
+                          .header_precision = GridFormat::uint32}},
+            {"base64_zlib_shuffled", {.encoder = GridFormat::Encoding::base64,
+                                      .compressor = GridFormat::Compression::zlib.with({.block_size = 100}),
+                                      .data_format = GridFormat::VTK::DataFormat::inlined,
+                                      .pre_filter = GridFormat::Compression::byte_shuffle}},
+#endif
+        }) {
+            GridFormat::VTIWriter region_writer{grid_3d, opts};
+            GridFormat::Test::add_test_data(region_writer, test_data, GridFormat::float32);
+            const auto filename = region_writer.write("vti_region_test_" + name);
+
+            GridFormat::VTIReader region_reader;
+            region_reader.open(filename);
+            for (const auto& [n, f] : cell_fields(region_reader))
+                expect_region(f, region_reader.cell_field(n, region), {5, 4, 3}, {1, 1, 0}, {3, 2, 2});
+            for (const auto& [n, f] : point_fields(region_reader))
+                expect_region(f, region_reader.point_field(n, region), {6, 5, 4}, {1, 1, 0}, {4, 3, 3});
+
+            // the entire piece and empty regions
+            const auto location = region_reader.location();
+            const auto cell_field_name = cell_field_names(region_reader).front();
+            expect_region(
+                region_reader.cell_field(cell_field_name),
+                region_reader.cell_field(cell_field_name, location),
+                {5, 4, 3}, {0, 0, 0}, {5, 4, 3}
+            );
+            expect(eq(region_reader.cell_field(cell_field_name, {{1, 1, 1}, {1, 3, 2}})->layout().extent(0), std::size_t{0}));
+            expect(throws<GridFormat::ValueError>([&] () {
+                region_reader.cell_field(cell_field_name, {{0, 0, 0}, {6, 4, 3}});
+            }));
+            std::filesystem::remove(filename);
+        }
+    };
+
     const std::string test_data_path_name{TEST_DATA_PATH};
     if (test_data_path_name.empty()) {
         std::cout << "No test data folder defined, skipping further tests" << std::endl;
@@ -59,10 +144,6 @@ int main() {
         return 42;
     }
 
-    using GridFormat::Testing::operator""_test;
-    using GridFormat::Testing::expect;
-    using GridFormat::Testing::eq;
-
     "vti_reader_name"_test = [&] () {
         expect(reader.name() == "VTIReader");
     };
@@ -24,7 +24,8 @@ int main() {
             "vtk_hdf_time_series_2d_in_2d_unstructured",
             GridFormat::VTK::HDFTransientOptions{
                 .static_grid = false,
-                .static_meta_data = false
+                .static_meta_data = false,
+                .detect_static_grid = false
             }
         };
         GridFormat::Test::write_test_time_series<2>(writer);
@@ -49,6 +50,60 @@ int main() {
         };
     }
 
+    {  // test with detection of the unchanged grid
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        GridFormat::VTKHDFTimeSeriesWriter writer{
+            grid,
+            "vtk_hdf_time_series_2d_in_2d_unstructured_detected_static_grid",
+            GridFormat::VTK::HDFTransientOptions{
+                .static_grid = false,
+                .static_meta_data = false,
+                .detect_static_grid = true
+            }
+        };
+        GridFormat::Test::write_test_time_series<2>(writer);
+
+        "hdf_time_series_detected_static_grid_steps_dimensions"_test = [&] () {
+            GridFormat::HDF5::File file{"vtk_hdf_time_series_2d_in_2d_unstructured_detected_static_grid.hdf"};
+            expect(eq(
+                file.get_dimensions("/VTKHDF/Points").value().at(0),
+                GridFormat::number_of_points(grid)
+            ));
+            auto cell_offsets = file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/CellOffsets");
+            auto point_offsets = file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/PointOffsets");
+            expect(std::ranges::equal(cell_offsets, std::vector{0, 0, 0, 0, 0}));
+            expect(std::ranges::equal(point_offsets, std::vector{0, 0, 0, 0, 0}));
+        };
+    }
+
+    {  // test with detection of unchanged fields
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        GridFormat::VTKHDFTimeSeriesWriter writer{
+            grid,
+            "vtk_hdf_time_series_2d_in_2d_unstructured_static_fields",
+            GridFormat::VTK::HDFTransientOptions{.detect_static_fields = true}
+        };
+        writer.set_point_field("static_point_field", [] (const auto&) { return 1.0; });
+        writer.set_cell_field("static_cell_field", [] (const auto&) { return 2; });
+        GridFormat::Test::write_test_time_series<2>(writer);
+
+        "hdf_time_series_static_fields_steps_dimensions"_test = [&] () {
+            GridFormat::HDF5::File file{"vtk_hdf_time_series_2d_in_2d_unstructured_static_fields.hdf"};
+            expect(eq(
+                file.get_dimensions("/VTKHDF/PointData/static_point_field").value().at(0),
+                GridFormat::number_of_points(grid)
+            ));
+            expect(eq(
+                file.get_dimensions("/VTKHDF/CellData/static_cell_field").value().at(0),
+                GridFormat::number_of_cells(grid)
+            ));
+            auto point_offsets = file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/PointDataOffsets/static_point_field");
+            auto cell_offsets = file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/CellDataOffsets/static_cell_field");
+            expect(std::ranges::equal(point_offsets, std::vector{0, 0, 0, 0, 0}));
+            expect(std::ranges::equal(cell_offsets, std::vector{0, 0, 0, 0, 0}));
+        };
+    }
+
     {  // test with static grid and meta data
         const auto grid = GridFormat::Test::make_unstructured<2, 2>();
         GridFormat::VTKHDFTimeSeriesWriter writer{
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <filesystem>
+#include <vector>
 
 #include <gridformat/vtk/hdf_unstructured_grid_writer.hpp>
 #include <gridformat/vtk/hdf_unstructured_grid_reader.hpp>
@@ -35,6 +36,37 @@ int main() {
         std::filesystem::remove("vtk_hdf_bool_field_test.hdf");
     };
 
+    "vtk_hdf_field_history_test"_test = [&] () {
+        GridFormat::VTKHDFUnstructuredTimeSeriesWriter writer{grid, "vtk_hdf_field_history_test"};
+        GridFormat::Test::write_test_time_series<2>(writer, 3, {}, false);
+
+        GridFormat::VTKHDFUnstructuredGridReader reader;
+        reader.open("vtk_hdf_field_history_test.hdf");
+        const std::vector<std::size_t> cells{2, 0, 2};
+        const std::vector<std::size_t> points{1, 3};
+        const auto cell_history = reader.cell_field_history("cscalar", cells);
+        const auto point_history = reader.point_field_history("pvector", points);
+        expect(eq(cell_history.size(), reader.number_of_steps()));
+        expect(eq(point_history.size(), reader.number_of_steps()));
+        for (std::size_t step = 0; step < reader.number_of_steps(); ++step) {
+            reader.set_step(step);
+            const auto all_cell_values = reader.cell_field("cscalar")->template export_to<std::vector<double>>();
+            const auto cell_values = cell_history[step]->template export_to<std::vector<double>>();
+            for (std::size_t i = 0; i < cells.size(); ++i)
+                expect(eq(cell_values.at(i), all_cell_values.at(cells[i])));
+
+            const auto all_point_values = reader.point_field("pvector")->template export_to<std::vector<double>>();
+            const auto point_values = point_history[step]->template export_to<std::vector<double>>();
+            const auto num_components = all_point_values.size()/reader.number_of_points();
+            expect(eq(point_values.size(), points.size()*num_components));
+            for (std::size_t i = 0; i < points.size(); ++i)
+                for (std::size_t c = 0; c < num_components; ++c)
+                    expect(eq(point_values.at(i*num_components + c), all_point_values.at(points[i]*num_components + c)));
+        }
+
+        std::filesystem::remove("vtk_hdf_field_history_test.hdf");
+    };
+
     {
         GridFormat::VTKHDFUnstructuredGridWriter writer{grid};
         {
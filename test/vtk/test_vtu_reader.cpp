@@ -2,14 +2,19 @@
 // SPDX-License-Identifier: MIT
 
 #include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
 #include <filesystem>
 #include <iterator>
 #include <algorithm>
 #include <ranges>
+#include <cmath>
 
 #include <gridformat/common/logging.hpp>
 #include <gridformat/vtk/vtu_reader.hpp>
 #include <gridformat/vtk/vtu_writer.hpp>
+#include <gridformat/grid/image_grid.hpp>
 
 #include "../grid/unstructured_grid.hpp"
 #include "../make_test_data.hpp"
@@ -44,6 +49,131 @@ int main() {
         std::filesystem::remove("vtu_bool_test.vtu");
     };
 
+    "vtu_probe_file_type"_test = [&] () {
+        GridFormat::VTUWriter probe_writer{grid};
+        const auto filename = probe_writer.write("vtu_probe_test");
+        expect(eq(GridFormat::VTK::XML::probe_file_type(filename).value(), std::string{"UnstructuredGrid"}));
+        expect(!GridFormat::VTK::XML::is_parallel_file_type("PolyData"));
+        expect(GridFormat::VTK::XML::is_parallel_file_type("PPolyData"));
+        std::filesystem::remove(filename);
+        expect(!GridFormat::VTK::XML::probe_file_type(filename).has_value());
+    };
+
+    "vtu_ascii_format_options"_test = [&] () {
+        // large enough for the ascii output to be formatted in several chunks
+        const GridFormat::ImageGrid<3, double> image{{1.0, 1.0, 1.0}, {60, 60, 30}};
+        const auto value = [&] (const auto& p) {
+            const auto x = GridFormat::coordinates(image, p);
+            return x[0]/3.0 + x[1]*x[2]/7.0;
+        };
+        for (const auto& opts : std::vector<GridFormat::AsciiFormatOptions>{
+            {.num_threads = 4},
+            {.shortest_round_trip = true},
+            {.shortest_round_trip = true, .num_threads = 4}
+        }) {
+            GridFormat::VTUWriter ascii_writer{image, {.encoder = GridFormat::Encoding::ascii.with(opts)}};
+            ascii_writer.set_point_field("pfield", value);
+            const auto filename = ascii_writer.write("vtu_ascii_options_test");
+
+            GridFormat::VTUReader ascii_reader;
+            ascii_reader.open(filename);
+            const auto values = ascii_reader.point_field("pfield")->template export_to<std::vector<double>>();
+            expect(eq(values.size(), GridFormat::number_of_points(image)));
+
+            std::size_t i = 0;
+            for (const auto& p : GridFormat::points(image)) {
+                const auto expected = value(p);
+                expect(opts.shortest_round_trip
+                    ? values[i] == expected
+                    : std::abs(values[i] - expected) <= 1e-12*std::max(std::abs(expected), 1.0)
+                );
+                ++i;
+            }
+            std::filesystem::remove(filename);
+        }
+    };
+
+    "vtu_pass_through_payload"_test = [&] () {
+        const auto values = GridFormat::make_field_ptr(GridFormat::RangeField{std::vector<double>{1.0, 2.0}});
+        const GridFormat::VTK::PassThroughField field{values, {
+            .encoding = "base64",
+            .compressor = "",
+            .header_type = "UInt64",
+            .pre_filter = "",
+            .byte_order = std::endian::native,
+            .read = [] () {
+                GridFormat::Serialization payload{7};
+                std::ranges::copy(std::string{"PAYLOAD"}, payload.template as_span_of<char>().begin());
+                return payload;
+            }
+        }};
+        // the payload is copied verbatim if the header precision matches
+        GridFormat::VTK::DataArray matching{field, GridFormat::Encoding::base64, GridFormat::none, GridFormat::uint64};
+        expect(!matching.number_of_streamed_bytes().has_value());
+        expect(eq(matching.number_of_streamed_bytes(true).value(), std::size_t{7}));
+        std::ostringstream matching_stream;
+        matching_stream << matching;
+        expect(eq(matching_stream.str(), std::string{"PAYLOAD"}));
+
+        GridFormat::VTK::DataArray other{field, GridFormat::Encoding::base64, GridFormat::none, GridFormat::uint32};
+        std::ostringstream other_stream;
+        other_stream << other;
+        expect(other_stream.str() != std::string{"PAYLOAD"});
+    };
+
+    "vtu_pass_through_conversion"_test = [&] () {
+        const auto make_writer = [&] (GridFormat::VTK::XMLOptions opts) {
+            GridFormat::VTUWriter w{grid, std::move(opts)};
+            return w;
+        };
+        for (const auto& [name, opts] : std::vector<std::pair<std::string, GridFormat::VTK::XMLOptions>>{
+            {"base64_inlined", {.encoder = GridFormat::Encoding::base64, .compressor = GridFormat::none,
+                                .data_format = GridFormat::VTK::DataFormat::inlined}},
+            {"raw_appended", {.encoder = GridFormat::Encoding::raw, .compressor = GridFormat::none,
+                              .data_format = GridFormat::VTK::DataFormat::appended,
+                              .header_precision = GridFormat::uint32}},
+#if GRIDFORMAT_HAVE_ZLIB
+            {"base64_zlib", {.encoder = GridFormat::Encoding::base64,
+                             .compressor = GridFormat::Compression::zlib.with({.block_size = 100}),
+                             .data_format = GridFormat::VTK::DataFormat::appended,
+                             .header_precision = GridFormat::uint32}},
+            {"raw_zlib_shuffled", {.encoder = GridFormat::Encoding::raw,
+                                   .compressor = GridFormat::Compression::zlib.with({.block_size = 100}),
+                                   .data_format = GridFormat::VTK::DataFormat::appended,
+                                   .pre_filter = GridFormat::Compression::byte_shuffle}},
+#endif
+        }) {
+            auto in_writer = make_writer(opts);
+            GridFormat::Test::add_meta_data(in_writer);
+            const auto test_data = GridFormat::Test::make_test_data<2>(grid, GridFormat::float64);
+            GridFormat::Test::add_test_data(in_writer, test_data, GridFormat::float32);
+            const auto in_filename = in_writer.write("pass_through_" + name + "_in");
+
+            GridFormat::VTUReader in_reader;
+            in_reader.open(in_filename);
+            auto out_writer = make_writer(opts);
+            for (const auto& [n, f] : point_fields(in_reader)) out_writer.set_point_field(n, f);
+            for (const auto& [n, f] : cell_fields(in_reader)) out_writer.set_cell_field(n, f);
+            const auto out_filename = out_writer.write("pass_through_" + name + "_out");
+
+            GridFormat::VTUReader out_reader;
+            out_reader.open(out_filename);
+            for (const auto& [n, f] : point_fields(in_reader)) {
+                const auto payload = dynamic_cast<const GridFormat::VTK::PassThroughField&>(*f).payload().read();
+                const auto out_payload = dynamic_cast<const GridFormat::VTK::PassThroughField&>(
+                    *out_reader.point_field(n)
+                ).payload().read();
+                expect(std::ranges::equal(payload.as_span(), out_payload.as_span()));
+                expect(GridFormat::Test::test_field_values<2>(n, out_reader.point_field(n), grid, GridFormat::points(grid)));
+            }
+            for (const auto& [n, f] : cell_fields(out_reader))
+                expect(GridFormat::Test::test_field_values<2>(n, f, grid, GridFormat::cells(grid)));
+
+            std::filesystem::remove(in_filename);
+            std::filesystem::remove(out_filename);
+        }
+    };
+
     GridFormat::VTUWriter writer{grid};
     GridFormat::VTUReader reader;
     GridFormat::Test::test_reader<2, 2>(
@@ -52,6 +182,87 @@ int main() {
         "reader_vtu_test_file_2d_in_2d"
     );
 
+    GridFormat::VTUWriter ascii_writer{grid, {
+        .encoder = GridFormat::Encoding::Ascii::with({
+            .delimiter = " ",
+            .entries_per_line = 15,
+            .shortest_round_trip = true
+        })
+    }};
+    GridFormat::Test::test_reader<2, 2>(
+        ascii_writer,
+        reader,
+        "reader_vtu_ascii_test_file_2d_in_2d"
+    );
+
+    // raw appended data is written with offsets computed before streaming the appendix
+    GridFormat::VTUWriter raw_writer{grid, {
+        .encoder = GridFormat::Encoding::raw,
+        .compressor = GridFormat::none,
+        .data_format = GridFormat::VTK::DataFormat::appended
+    }};
+    GridFormat::Test::test_reader<2, 2>(
+        raw_writer,
+        reader,
+        "reader_vtu_raw_appended_test_file_2d_in_2d"
+    );
+
+#if GRIDFORMAT_HAVE_ZLIB
+    // VTK cannot undo the pre-filters, so we use names not matched by the regression test
+    for (const auto& [filter_name, filter] : std::vector<std::pair<std::string, GridFormat::Compression::PreFilter>>{
+        {"byte_shuffle", GridFormat::Compression::byte_shuffle},
+        {"bit_shuffle_delta", {.shuffle = GridFormat::Compression::Shuffle::bit, .delta = true}}
+    }) {
+        GridFormat::VTUWriter filter_writer{grid, {
+            .encoder = GridFormat::Encoding::base64,
+            .compressor = GridFormat::Compression::zlib.with({.block_size = 100}),
+            .data_format = GridFormat::VTK::DataFormat::appended,
+            .pre_filter = filter
+        }};
+        GridFormat::Test::test_reader<2, 2>(
+            filter_writer,
+            reader,
+            filter_name + "_reader_vtu_test_file_2d_in_2d"
+        );
+    }
+#endif
+
+#if GRIDFORMAT_HAVE_ZSTD
+    // VTK cannot read zstd-compressed files, so we use a name not matched by the regression test
+    GridFormat::VTUWriter zstd_writer{grid, {
+        .encoder = GridFormat::Encoding::raw,
+        .compressor = GridFormat::Compression::zstd.with({.block_size = 100}),
+        .data_format = GridFormat::VTK::DataFormat::appended
+    }};
+    GridFormat::Test::test_reader<2, 2>(
+        zstd_writer,
+        reader,
+        "zstd_reader_vtu_test_file_2d_in_2d"
+    );
+#endif
+
+    // arrays written with adaptive compression store their compressor in a custom attribute,
+    // which VTK does not know, so we use names not matched by the regression test
+    for (const auto& [name, bandwidth] : std::vector<std::pair<std::string, double>>{
+        {"uncompressed", 1e300}, {"compressed", 1.0}
+    }) {
+        GridFormat::VTUWriter adaptive_writer{grid, {
+            .encoder = GridFormat::Encoding::base64,
+            .compressor = GridFormat::Compression::Adaptive::with({
+                .block_size = 100,
+                .write_bandwidth = bandwidth,
+                .min_array_size = 0
+            }),
+            .data_format = GridFormat::VTK::DataFormat::appended,
+            .pre_filter = GridFormat::Compression::byte_shuffle
+        }};
+        GridFormat::Test::test_reader<2, 2>(
+            adaptive_writer,
+            reader,
+            "adaptive_" + name + "_reader_vtu_test_file_2d_in_2d"
+        );
+    }
+
     const std::string test_data_path_name{TEST_DATA_PATH};
     if (test_data_path_name.empty()) {
         std::cout << "No test data folder defined, skipping further tests" << std::endl;
@@ -1,12 +1,120 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
+#include <array>
+#include <vector>
+#include <ranges>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <streambuf>
+#include <string>
+
+#include <gridformat/common/output_sink.hpp>
+#include <gridformat/parallel/communication.hpp>
 #include <gridformat/vtk/vtu_writer.hpp>
+#include <gridformat/vtk/pvtu_writer.hpp>
+#include <gridformat/vtk/vtu_reader.hpp>
 
 #include "../grid/unstructured_grid.hpp"
 #include "../grid/structured_grid.hpp"
 #include "../make_test_data.hpp"
 #include "vtk_writer_tester.hpp"
+#include "../testing.hpp"
+
+// grid storing its points & cells in flat arrays, optionally exposing them via the bulk traits
+template<bool expose_arrays>
+struct FlatGrid {
+    std::vector<double> coordinates;
+    std::vector<int> connectivity;
+    std::vector<int> offsets;
+    std::vector<GridFormat::CellType> types;
+};
+
+namespace GridFormat::Traits {
+
+template<bool e> struct Points<FlatGrid<e>> {
+    static auto get(const FlatGrid<e>& g) { return std::views::iota(std::size_t{0}, g.coordinates.size()/3); }
+};
+template<bool e> struct Cells<FlatGrid<e>> {
+    static auto get(const FlatGrid<e>& g) { return std::views::iota(std::size_t{0}, g.types.size()); }
+};
+template<bool e> struct PointCoordinates<FlatGrid<e>, std::size_t> {
+    static auto get(const FlatGrid<e>& g, std::size_t p) {
+        return std::array{g.coordinates[p*3], g.coordinates[p*3 + 1], g.coordinates[p*3 + 2]};
+    }
+};
+template<bool e> struct PointId<FlatGrid<e>, std::size_t> {
+    static auto get(const FlatGrid<e>&, std::size_t p) { return p; }
+};
+template<bool e> struct CellType<FlatGrid<e>, std::size_t> {
+    static auto get(const FlatGrid<e>& g, std::size_t c) { return g.types[c]; }
+};
+template<bool e> struct CellPoints<FlatGrid<e>, std::size_t> {
+    static auto get(const FlatGrid<e>& g, std::size_t c) {
+        const auto begin = c == 0 ? 0 : g.offsets[c-1];
+        return std::span{g.connectivity}.subspan(begin, g.offsets[c] - begin)
+            | std::views::transform([] (int i) { return static_cast<std::size_t>(i); });
+    }
+};
+
+template<> struct Coordinates<FlatGrid<true>> {
+    static std::span<const double> get(const FlatGrid<true>& g) { return g.coordinates; }
+};
+template<> struct Connectivity<FlatGrid<true>> {
+    static std::span<const int> get(const FlatGrid<true>& g) { return g.connectivity; }
+};
+template<> struct Offsets<FlatGrid<true>> {
+    static std::span<const int> get(const FlatGrid<true>& g) { return g.offsets; }
+};
+template<> struct CellTypes<FlatGrid<true>> {
+    static std::span<const GridFormat::CellType> get(const FlatGrid<true>& g) { return g.types; }
+};
+
+}  // namespace GridFormat::Traits
+
+static_assert(GridFormat::GridDetail::ExposesCoordinates<FlatGrid<true>>);
+static_assert(GridFormat::GridDetail::ExposesConnectivity<FlatGrid<true>>);
+static_assert(GridFormat::GridDetail::ExposesOffsets<FlatGrid<true>>);
+static_assert(GridFormat::GridDetail::ExposesCellTypes<FlatGrid<true>>);
+static_assert(!GridFormat::GridDetail::ExposesConnectivity<FlatGrid<false>>);
+
+template<bool expose_arrays>
+std::string write_flat_grid() {
+    const FlatGrid<expose_arrays> grid{
+        .coordinates = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 2.0, 0.0, 0.0},
+        .connectivity = {0, 1, 3, 2, 1, 4, 3},
+        .offsets = {4, 7},
+        .types = {GridFormat::CellType::quadrilateral, GridFormat::CellType::triangle}
+    };
+    GridFormat::VTUWriter writer{grid, {.encoder = GridFormat::Encoding::ascii}};
+    writer.set_point_field("pfield", [] (std::size_t p) { return static_cast<double>(p); });
+    std::ostringstream s;
+    writer.write(s);
+    return s.str();
+}
+
+// stream buffer that does not support seeking (as is the case for e.g. pipes or sockets)
+class ForwardOnlyBuffer : public std::streambuf {
+ public:
+    const std::string& str() const { return _data; }
+
+ protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+            _data.push_back(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        _data.append(s, n);
+        return n;
+    }
+
+ private:
+    std::string _data;
+};
 
 template<int dim, int space_dim>
 void _test() {
@@ -20,6 +128,145 @@ void _test() {
 }
 
 int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    "vtu_writer_bulk_grid_traits"_test = [] () {
+        expect(eq(write_flat_grid<true>(), write_flat_grid<false>()));
+    };
+
+    "vtu_writer_appended_data_to_non_seekable_stream"_test = [] () {
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        const auto write = [&] (const GridFormat::VTK::XMLOptions& opts, std::ostream& s) {
+            GridFormat::VTUWriter writer{grid, opts};
+            writer.set_point_field("pfield", [&] (const auto& p) { return GridFormat::coordinates(grid, p)[0]; });
+            writer.set_cell_field("cfield", [] (const auto&) { return 42; });
+            writer.write(s);
+        };
+        const auto read_fields = [] (const std::string& content, const std::string& filename) {
+            std::ofstream{filename} << content;
+            GridFormat::VTUReader reader;
+            reader.open(filename);
+            return std::array{
+                reader.point_field("pfield")->template export_to<std::vector<double>>(),
+                reader.cell_field("cfield")->template export_to<std::vector<double>>()
+            };
+        };
+        // offsets patched into placeholders are padded with blanks
+        const auto has_patched_offsets = [] (const std::string& content) {
+            return content.find("offset=\"0 ") != std::string::npos;
+        };
+
+        // without compression, the sizes are known upfront and both streams take the forward-only path
+        for (const auto& encoder : std::vector<GridFormat::VTK::XMLOptions::EncoderOption>{
+            GridFormat::Encoding::raw, GridFormat::Encoding::base64
+        }) {
+            const GridFormat::VTK::XMLOptions opts{
+                .encoder = encoder,
+                .compressor = GridFormat::none,
+                .data_format = GridFormat::VTK::DataFormat::appended
+            };
+            std::ostringstream seekable;
+            write(opts, seekable);
+
+            ForwardOnlyBuffer buffer;
+            std::ostream forward_only{&buffer};
+            write(opts, forward_only);
+            expect(forward_only.good());
+            expect(eq(buffer.str(), seekable.str()));
+            expect(!has_patched_offsets(seekable.str()));
+        }
+
+#if GRIDFORMAT_HAVE_ZLIB
+        // with compression, seekable streams are patched after streaming the appendix,
+        // while the compressed sizes are precomputed for non-seekable streams
+        for (const auto& encoder : std::vector<GridFormat::VTK::XMLOptions::EncoderOption>{
+            GridFormat::Encoding::raw, GridFormat::Encoding::base64
+        }) {
+            const GridFormat::VTK::XMLOptions opts{
+                .encoder = encoder,
+                .compressor = GridFormat::Compression::zlib,
+                .data_format = GridFormat::VTK::DataFormat::appended
+            };
+            std::ostringstream seekable;
+            write(opts, seekable);
+            expect(has_patched_offsets(seekable.str()));
+
+            ForwardOnlyBuffer buffer;
+            std::ostream forward_only{&buffer};
+            write(opts, forward_only);
+            expect(forward_only.good());
+            expect(!has_patched_offsets(buffer.str()));
+
+            const auto expected = read_fields(seekable.str(), "vtu_appended_seekable.vtu");
+            const auto actual = read_fields(buffer.str(), "vtu_appended_forward_only.vtu");
+            expect(std::ranges::equal(expected[0], actual[0]));
+            expect(std::ranges::equal(expected[1], actual[1]));
+            expect(eq(expected[1].size(), GridFormat::number_of_cells(grid)));
+        }
+#endif
+    };
+
+    "vtu_writer_into_sink"_test = [] () {
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        GridFormat::VTUWriter writer{grid, {.encoder = GridFormat::Encoding::raw}};
+        writer.set_point_field("pfield", [&] (const auto& p) { return GridFormat::coordinates(grid, p)[0]; });
+
+        std::ostringstream expected;
+        writer.write(expected);
+
+        GridFormat::RingBufferSink ring_buffer{2};
+        expect(eq(writer.write("vtu_sink_0", ring_buffer), std::string{"vtu_sink_0.vtu"}));
+        expect(eq(writer.write("vtu_sink_1", ring_buffer), std::string{"vtu_sink_1.vtu"}));
+        expect(eq(writer.write("vtu_sink_2", ring_buffer), std::string{"vtu_sink_2.vtu"}));
+        expect(eq(ring_buffer.size(), 2));
+        expect(eq(ring_buffer.number_of_dropped_buffers(), 1));
+        for (const std::string name : {"vtu_sink_1.vtu", "vtu_sink_2.vtu"}) {
+            const auto buffer = ring_buffer.try_pop();
+            expect(buffer.has_value());
+            expect(eq(buffer->name, name));
+            expect(eq(buffer->content, expected.str()));
+        }
+        expect(!ring_buffer.try_pop().has_value());
+
+        std::vector<std::string> received;
+        GridFormat::CallbackSink callback{[&] (GridFormat::OutputBuffer&& buffer) {
+            received.push_back(std::move(buffer.name));
+        }};
+        writer.write("vtu_sink_3", callback);
+        expect(eq(received.size(), 1));
+        expect(eq(received.at(0), std::string{"vtu_sink_3.vtu"}));
+    };
+
+    "pvtu_writer_into_sink"_test = [] () {
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        GridFormat::PVTUWriter writer{grid, GridFormat::NullCommunicator{}, {
+            .encoder = GridFormat::Encoding::raw,
+            .data_format = GridFormat::VTK::DataFormat::appended
+        }};
+        writer.set_cell_field("cfield", [] (const auto&) { return 42; });
+
+        std::vector<GridFormat::OutputBuffer> received;
+        GridFormat::CallbackSink sink{[&] (GridFormat::OutputBuffer&& buffer) {
+            received.push_back(std::move(buffer));
+        }};
+        writer.write("pvtu_sink", sink);
+        expect(eq(received.size(), 2));
+        expect(eq(received.at(0).name, std::string{"pvtu_sink-0.vtu"}));
+        expect(eq(received.at(1).name, std::string{"pvtu_sink.pvtu"}));
+        expect(received.at(1).content.find("pvtu_sink-0.vtu") != std::string::npos);
+
+        GridFormat::VTUWriter piece_writer{grid, {
+            .encoder = GridFormat::Encoding::raw,
+            .data_format = GridFormat::VTK::DataFormat::appended
+        }};
+        piece_writer.set_cell_field("cfield", [] (const auto&) { return 42; });
+        std::ostringstream expected;
+        piece_writer.write(expected);
+        expect(eq(received.at(0).content, expected.str()));
+    };
+
     _test<0, 1>();
     _test<0, 2>();
     _test<0, 3>();
@@ -33,6 +33,7 @@ using namespace GridFormat::VTK::DataFormat;
 template<typename T>
 std::string _name(const T& t) { return GridFormat::VTK::attribute_name(t); }
 std::string _name(const None&) { return "none"; }
+std::string _name(const Adaptive&) { return "adaptive"; }
 std::string _name(const Automatic&) { return "auto"; }
 std::string _name(const Inlined&) { return "inlined"; }
 std::string _name(const Appended&) { return "appended"; }